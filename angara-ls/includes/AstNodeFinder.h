@@ -61,6 +61,7 @@ private:
     std::any visit(const MatchExpr& expr) override;
     std::any visit(const SizeofExpr& expr) override;
     std::any visit(const RetypeExpr& expr) override;
+    std::any visit(const InterpolatedExpr& expr) override;
 
     // --- Helper Methods ---
     // Checks if the current target position is within a given range.
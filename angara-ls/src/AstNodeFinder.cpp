@@ -217,4 +217,10 @@ std::any AstNodeFinder::visit(const MatchExpr& expr) {
         return {};
     }
 
+    std::any AstNodeFinder::visit(const InterpolatedExpr& expr) {
+        // The segments and embedded expressions carry their own positions.
+        for (const auto& part : expr.parts) part->accept(*this);
+        return {};
+    }
+
 } // namespace angara
\ No newline at end of file
@@ -0,0 +1,498 @@
+#include "OwnershipAnalyzer.h"
+
+namespace angara {
+
+    namespace {
+        // Looks through redundant parentheses.
+        std::shared_ptr<Expr> stripGrouping(std::shared_ptr<Expr> expr) {
+            while (auto grouping = std::dynamic_pointer_cast<const Grouping>(expr)) {
+                expr = grouping->expression;
+            }
+            return expr;
+        }
+
+        OwnershipAnalyzer::Ownership combine(OwnershipAnalyzer::Ownership a, OwnershipAnalyzer::Ownership b) {
+            using Ownership = OwnershipAnalyzer::Ownership;
+            if (a == Ownership::Owned || b == Ownership::Owned) return Ownership::Owned;
+            if (a == Ownership::Static && b == Ownership::Static) return Ownership::Static;
+            return Ownership::Borrowed;
+        }
+    }
+
+    OwnershipAnalyzer::OwnershipAnalyzer(TypeChecker& type_checker) : m_type_checker(type_checker) {}
+
+    void OwnershipAnalyzer::analyze(const std::vector<std::shared_ptr<Stmt>>& statements) {
+        for (const auto& stmt : statements) {
+            if (auto func_stmt = std::dynamic_pointer_cast<const FuncStmt>(stmt)) {
+                if (func_stmt->is_foreign || !func_stmt->body) continue;
+                auto symbol = m_type_checker.m_symbols.resolve(func_stmt->name.lexeme);
+                analyzeFunction(*func_stmt, std::dynamic_pointer_cast<FunctionType>(symbol->type));
+            } else if (auto class_stmt = std::dynamic_pointer_cast<const ClassStmt>(stmt)) {
+                auto class_type = std::dynamic_pointer_cast<ClassType>(
+                    m_type_checker.m_symbols.resolve(class_stmt->name.lexeme)->type);
+                for (const auto& member : class_stmt->members) {
+                    if (auto method_member = std::dynamic_pointer_cast<const MethodMember>(member)) {
+                        const auto& method = method_member->declaration;
+                        if (!method->body) continue;
+                        auto method_type = std::dynamic_pointer_cast<FunctionType>(
+                            class_type->methods.at(method->name.lexeme).type);
+                        analyzeFunction(*method, method_type);
+                    }
+                }
+            }
+        }
+    }
+
+    void OwnershipAnalyzer::analyzeFunction(const FuncStmt& stmt, const std::shared_ptr<FunctionType>& type) {
+        // 1. Reset the per-function state and declare the parameters.
+        m_current_function = &stmt;
+        m_owned_params.assign(stmt.params.size(), false);
+        m_declarations.clear();
+        m_uses.clear();
+        m_loop_depth = 0;
+        m_try_depth = 0;
+        m_statement = 0;
+        for (const auto& param : stmt.params) declare(param.name);
+
+        // 2. Walk the body in program order, recording every read of a local.
+        for (const auto& body_stmt : *stmt.body) walkStmt(body_stmt);
+
+        // 3. The textually last read of a local may move its reference, provided that
+        //    nothing can run it again (a loop the local outlives), a longjmp cannot
+        //    observe the moved-from local (a `try` it was declared outside of), and
+        //    it is the only read in its statement, whose evaluation order C leaves open.
+        for (const auto& [key, uses] : m_uses) {
+            auto decl = m_declarations.find(key);
+            if (decl == m_declarations.end() || uses.empty()) continue;
+            const Use& last = uses.back();
+            if (last.loop_depth != decl->second.loop_depth || last.try_depth != decl->second.try_depth) continue;
+            int reads_in_statement = 0;
+            for (const auto& use : uses) {
+                if (use.statement == last.statement) reads_in_statement++;
+            }
+            if (reads_in_statement == 1) m_moves.insert(last.expr);
+        }
+
+        // 4. Publish the parameter conventions for callers and for the callee itself.
+        if (type) type->owned_params = m_owned_params;
+        m_current_function = nullptr;
+    }
+
+    void OwnershipAnalyzer::declare(const Token& name) {
+        m_declarations[{name.line, name.column}] = {m_loop_depth, m_try_depth};
+    }
+
+    const Symbol* OwnershipAnalyzer::resolveLocal(const VarExpr& expr) const {
+        auto it = m_type_checker.m_variable_resolutions.find(&expr);
+        if (it == m_type_checker.m_variable_resolutions.end() || !it->second || it->second->depth == 0) {
+            return nullptr;
+        }
+        return it->second.get();
+    }
+
+    void OwnershipAnalyzer::consume(const std::shared_ptr<Expr>& expr) {
+        auto inner = stripGrouping(expr);
+        if (auto ternary = std::dynamic_pointer_cast<const TernaryExpr>(inner)) {
+            consume(ternary->thenBranch);
+            consume(ternary->elseBranch);
+            return;
+        }
+        auto var_expr = std::dynamic_pointer_cast<const VarExpr>(inner);
+        if (!var_expr || !m_current_function) return;
+        const Symbol* symbol = resolveLocal(*var_expr);
+        if (!symbol) return;
+        const auto& params = m_current_function->params;
+        for (size_t i = 0; i < params.size(); ++i) {
+            if (params[i].name.line == symbol->declaration_token.line &&
+                params[i].name.column == symbol->declaration_token.column) {
+                m_owned_params[i] = true;
+            }
+        }
+    }
+
+    void OwnershipAnalyzer::walkStmt(const std::shared_ptr<Stmt>& stmt) {
+        if (!stmt) return;
+        m_statement++;
+
+        if (auto var_decl = std::dynamic_pointer_cast<const VarDeclStmt>(stmt)) {
+            if (var_decl->initializer) {
+                walkExpr(var_decl->initializer);
+                consume(var_decl->initializer);
+            }
+            declare(var_decl->name);
+        } else if (auto expr_stmt = std::dynamic_pointer_cast<const ExpressionStmt>(stmt)) {
+            walkExpr(expr_stmt->expression);
+        } else if (auto block = std::dynamic_pointer_cast<const BlockStmt>(stmt)) {
+            for (const auto& s : block->statements) walkStmt(s);
+        } else if (auto if_stmt = std::dynamic_pointer_cast<const IfStmt>(stmt)) {
+            if (if_stmt->declaration) {
+                walkExpr(if_stmt->declaration->initializer);
+                declare(if_stmt->declaration->name);
+            } else {
+                walkExpr(if_stmt->condition);
+            }
+            walkStmt(if_stmt->thenBranch);
+            walkStmt(if_stmt->elseBranch);
+        } else if (auto while_stmt = std::dynamic_pointer_cast<const WhileStmt>(stmt)) {
+            m_loop_depth++;
+            walkExpr(while_stmt->condition);
+            walkStmt(while_stmt->body);
+            m_loop_depth--;
+        } else if (auto for_stmt = std::dynamic_pointer_cast<const ForStmt>(stmt)) {
+            walkStmt(for_stmt->initializer);
+            m_loop_depth++;
+            m_statement++;
+            walkExpr(for_stmt->condition);
+            m_statement++;
+            walkExpr(for_stmt->increment);
+            walkStmt(for_stmt->body);
+            m_loop_depth--;
+        } else if (auto for_in = std::dynamic_pointer_cast<const ForInStmt>(stmt)) {
+            walkExpr(for_in->collection);
+            if (!mayReleaseItems(for_in->body)) m_borrowing_loops.insert(for_in.get());
+            m_loop_depth++;
+            declare(for_in->name);
+            walkStmt(for_in->body);
+            m_loop_depth--;
+        } else if (auto ret_stmt = std::dynamic_pointer_cast<const ReturnStmt>(stmt)) {
+            if (ret_stmt->value) {
+                walkExpr(ret_stmt->value);
+                consume(ret_stmt->value);
+            }
+        } else if (auto throw_stmt = std::dynamic_pointer_cast<const ThrowStmt>(stmt)) {
+            walkExpr(throw_stmt->expression);
+        } else if (auto try_stmt = std::dynamic_pointer_cast<const TryStmt>(stmt)) {
+            m_try_depth++;
+            walkStmt(try_stmt->tryBlock);
+            m_try_depth--;
+            declare(try_stmt->catchName);
+            walkStmt(try_stmt->catchBlock);
+        }
+    }
+
+    void OwnershipAnalyzer::walkExpr(const std::shared_ptr<Expr>& expr) {
+        if (!expr) return;
+
+        if (auto var_expr = std::dynamic_pointer_cast<const VarExpr>(expr)) {
+            if (const Symbol* symbol = resolveLocal(*var_expr)) {
+                DeclKey key{symbol->declaration_token.line, symbol->declaration_token.column};
+                m_uses[key].push_back({var_expr.get(), m_loop_depth, m_try_depth, m_statement});
+            }
+        } else if (auto grouping = std::dynamic_pointer_cast<const Grouping>(expr)) {
+            walkExpr(grouping->expression);
+        } else if (auto binary = std::dynamic_pointer_cast<const Binary>(expr)) {
+            walkExpr(binary->left);
+            walkExpr(binary->right);
+        } else if (auto unary = std::dynamic_pointer_cast<const Unary>(expr)) {
+            walkExpr(unary->right);
+        } else if (auto logical = std::dynamic_pointer_cast<const LogicalExpr>(expr)) {
+            walkExpr(logical->left);
+            walkExpr(logical->right);
+        } else if (auto assign = std::dynamic_pointer_cast<const AssignExpr>(expr)) {
+            walkExpr(assign->target);
+            walkExpr(assign->value);
+            if (assign->op.type == TokenType::EQUAL) consume(assign->value);
+            // A local written inside a `try` it was declared outside of is read back after a longjmp.
+            if (auto var_target = std::dynamic_pointer_cast<const VarExpr>(assign->target)) {
+                if (const Symbol* symbol = resolveLocal(*var_target)) {
+                    DeclKey key{symbol->declaration_token.line, symbol->declaration_token.column};
+                    auto decl = m_declarations.find(key);
+                    if (decl != m_declarations.end() && decl->second.try_depth < m_try_depth) {
+                        m_volatile_locals.insert(key);
+                    }
+                }
+            }
+        } else if (auto update = std::dynamic_pointer_cast<const UpdateExpr>(expr)) {
+            walkExpr(update->target);
+            if (auto var_target = std::dynamic_pointer_cast<const VarExpr>(update->target)) {
+                if (const Symbol* symbol = resolveLocal(*var_target)) {
+                    DeclKey key{symbol->declaration_token.line, symbol->declaration_token.column};
+                    auto decl = m_declarations.find(key);
+                    if (decl != m_declarations.end() && decl->second.try_depth < m_try_depth) {
+                        m_volatile_locals.insert(key);
+                    }
+                }
+            }
+        } else if (auto call = std::dynamic_pointer_cast<const CallExpr>(expr)) {
+            walkExpr(call->callee);
+            for (const auto& arg : call->arguments) walkExpr(arg);
+            // Data and enum constructors store their arguments as they are.
+            if (isConstructorCall(*call)) {
+                for (const auto& arg : call->arguments) consume(arg);
+            }
+        } else if (auto get = std::dynamic_pointer_cast<const GetExpr>(expr)) {
+            walkExpr(get->object);
+        } else if (auto list = std::dynamic_pointer_cast<const ListExpr>(expr)) {
+            for (const auto& element : list->elements) walkExpr(element);
+        } else if (auto record = std::dynamic_pointer_cast<const RecordExpr>(expr)) {
+            for (const auto& value : record->values) walkExpr(value);
+        } else if (auto subscript = std::dynamic_pointer_cast<const SubscriptExpr>(expr)) {
+            walkExpr(subscript->object);
+            walkExpr(subscript->index);
+        } else if (auto ternary = std::dynamic_pointer_cast<const TernaryExpr>(expr)) {
+            walkExpr(ternary->condition);
+            walkExpr(ternary->thenBranch);
+            walkExpr(ternary->elseBranch);
+        } else if (auto is_expr = std::dynamic_pointer_cast<const IsExpr>(expr)) {
+            walkExpr(is_expr->object);
+        } else if (auto match = std::dynamic_pointer_cast<const MatchExpr>(expr)) {
+            walkExpr(match->condition);
+            for (const auto& case_item : match->cases) {
+                for (const auto& variable : case_item.variables) declare(variable);
+                walkExpr(case_item.body);
+            }
+        } else if (auto retype = std::dynamic_pointer_cast<const RetypeExpr>(expr)) {
+            walkExpr(retype->expression);
+        } else if (auto interpolated = std::dynamic_pointer_cast<const InterpolatedExpr>(expr)) {
+            for (const auto& part : interpolated->parts) walkExpr(part);
+        }
+    }
+
+    bool OwnershipAnalyzer::isConstructorCall(const CallExpr& expr) const {
+        auto callee_type = m_type_checker.m_expression_types.at(expr.callee.get());
+        if (callee_type->kind == TypeKind::DATA) return true;
+        if (std::dynamic_pointer_cast<const GetExpr>(expr.callee) && callee_type->kind == TypeKind::FUNCTION) {
+            auto func_type = std::dynamic_pointer_cast<FunctionType>(callee_type);
+            return func_type->return_type->kind == TypeKind::ENUM;
+        }
+        return false;
+    }
+
+    OwnershipAnalyzer::Ownership OwnershipAnalyzer::ownership(const std::shared_ptr<Expr>& expr) const {
+        if (!expr) return Ownership::Static;
+
+        // Constants are immortal, and numbers, booleans and nil are not objects at all.
+        if (std::dynamic_pointer_cast<const Literal>(expr) || std::dynamic_pointer_cast<const Unary>(expr) ||
+            std::dynamic_pointer_cast<const UpdateExpr>(expr) || std::dynamic_pointer_cast<const IsExpr>(expr) ||
+            std::dynamic_pointer_cast<const SizeofExpr>(expr)) {
+            return Ownership::Static;
+        }
+        if (auto grouping = std::dynamic_pointer_cast<const Grouping>(expr)) {
+            return ownership(grouping->expression);
+        }
+        if (auto binary = std::dynamic_pointer_cast<const Binary>(expr)) {
+            // Only string concatenation builds an object.
+            auto result_type = m_type_checker.m_expression_types.at(expr.get());
+            return result_type->toString() == "string" ? Ownership::Owned : Ownership::Static;
+        }
+        if (auto logical = std::dynamic_pointer_cast<const LogicalExpr>(expr)) {
+            if (logical->op.type != TokenType::QUESTION_QUESTION) return Ownership::Static;
+            return combine(ownership(logical->left), ownership(logical->right));
+        }
+        if (auto ternary = std::dynamic_pointer_cast<const TernaryExpr>(expr)) {
+            return combine(ownership(ternary->thenBranch), ownership(ternary->elseBranch));
+        }
+        if (auto match = std::dynamic_pointer_cast<const MatchExpr>(expr)) {
+            // A binding borrows from the matched value, which dies with the match,
+            // so a result that is not a constant is always handed out owned.
+            for (const auto& case_item : match->cases) {
+                if (ownership(case_item.body) != Ownership::Static) return Ownership::Owned;
+            }
+            return Ownership::Static;
+        }
+        if (auto get = std::dynamic_pointer_cast<const GetExpr>(expr)) {
+            auto object_type = m_type_checker.m_expression_types.at(get->object.get());
+            if (object_type->kind == TypeKind::OPTIONAL) {
+                object_type = std::dynamic_pointer_cast<OptionalType>(object_type)->wrapped_type;
+            }
+            if (object_type->kind == TypeKind::MODULE) return Ownership::Borrowed;
+            // A nullary variant is an immortal instance shared by every use.
+            if (object_type->kind == TypeKind::ENUM) return Ownership::Static;
+            // Foreign fields are converted into fresh Angara values.
+            if (auto data_type = std::dynamic_pointer_cast<DataType>(object_type)) {
+                if (data_type->is_foreign) return Ownership::Owned;
+            }
+            // A field is borrowed from its object, unless that object is a temporary.
+            return ownership(get->object) == Ownership::Owned ? Ownership::Owned : Ownership::Borrowed;
+        }
+        if (std::dynamic_pointer_cast<const CallExpr>(expr) || std::dynamic_pointer_cast<const ListExpr>(expr) ||
+            std::dynamic_pointer_cast<const RecordExpr>(expr) || std::dynamic_pointer_cast<const SubscriptExpr>(expr) ||
+            std::dynamic_pointer_cast<const RetypeExpr>(expr) || std::dynamic_pointer_cast<const InterpolatedExpr>(expr)) {
+            return Ownership::Owned;
+        }
+        // Variables, `this` and assignments refer to a reference held elsewhere.
+        return Ownership::Borrowed;
+    }
+
+    bool OwnershipAnalyzer::isOwned(const std::shared_ptr<Expr>& expr) const {
+        return ownership(expr) == Ownership::Owned;
+    }
+
+    bool OwnershipAnalyzer::canMove(const VarExpr& expr) const {
+        return m_moves.count(&expr) > 0;
+    }
+
+    bool OwnershipAnalyzer::borrowsItems(const ForInStmt& stmt) const {
+        return m_borrowing_loops.count(&stmt) > 0;
+    }
+
+    bool OwnershipAnalyzer::needsVolatile(const Token& name) const {
+        return m_volatile_locals.count({name.line, name.column}) > 0;
+    }
+
+    bool OwnershipAnalyzer::isReuseSite(const AssignExpr& expr) const {
+        if (expr.op.type != TokenType::EQUAL) return false;
+        auto var_target = std::dynamic_pointer_cast<const VarExpr>(expr.target);
+        if (!var_target || !resolveLocal(*var_target)) return false;
+        auto call = std::dynamic_pointer_cast<const CallExpr>(stripGrouping(expr.value));
+        if (!call || !std::dynamic_pointer_cast<const VarExpr>(call->callee)) return false;
+
+        auto data_type = std::dynamic_pointer_cast<DataType>(m_type_checker.m_expression_types.at(call->callee.get()));
+        auto target_type = m_type_checker.m_variable_resolutions.at(var_target.get())->type;
+        return data_type && !data_type->is_foreign &&
+               target_type->kind == TypeKind::DATA && target_type->toString() == data_type->name;
+    }
+
+    // --- Item Borrowing ---
+    // A for-in loop may borrow the list's items only if nothing in its body can
+    // drop the list's reference to one: no element is overwritten or removed,
+    // and no code runs that the analysis cannot see into.
+
+    bool OwnershipAnalyzer::isTransparentCall(const CallExpr& expr) const {
+        // Native functions cannot reach a list unless one is passed to them.
+        auto only_plain_arguments = [&]() {
+            for (const auto& arg : expr.arguments) {
+                auto arg_type = m_type_checker.m_expression_types.at(arg.get());
+                const std::string name = arg_type->toString();
+                if (!isNumeric(arg_type) && name != "string" && name != "bool" && name != "nil") return false;
+            }
+            return true;
+        };
+
+        auto callee_type = m_type_checker.m_expression_types.at(expr.callee.get());
+        if (auto get = std::dynamic_pointer_cast<const GetExpr>(expr.callee)) {
+            auto object_type = m_type_checker.m_expression_types.at(get->object.get());
+            const std::string& name = get->name.lexeme;
+            if (object_type->kind == TypeKind::LIST) return name == "push";
+            if (object_type->kind == TypeKind::RECORD) return true;
+            if (object_type->kind == TypeKind::ENUM) return true;
+            if (object_type->kind == TypeKind::STRING_BUILDER) return true;
+            if (auto module_type = std::dynamic_pointer_cast<ModuleType>(object_type)) {
+                return module_type->is_native && only_plain_arguments();
+            }
+            return false;
+        }
+
+        if (auto var_expr = std::dynamic_pointer_cast<const VarExpr>(expr.callee)) {
+            if (callee_type->kind == TypeKind::DATA) return true;
+            auto it = m_type_checker.m_variable_resolutions.find(var_expr.get());
+            if (it == m_type_checker.m_variable_resolutions.end() || !it->second) return false;
+            const auto& symbol = it->second;
+            if (symbol->from_module && symbol->from_module->is_native) return only_plain_arguments();
+            if (auto func_type = std::dynamic_pointer_cast<FunctionType>(symbol->type)) {
+                if (func_type->is_foreign) return true;
+            }
+            // Built-in functions are declared without a source position.
+            static const std::set<std::string> pure_builtins = {
+                "len", "typeof", "string", "i64", "int", "f64", "float", "bool", "Exception", "Mutex", "StringBuilder", "range"
+            };
+            return symbol->declaration_token.line == 0 && pure_builtins.count(var_expr->name.lexeme) > 0;
+        }
+        return false;
+    }
+
+    bool OwnershipAnalyzer::mayReleaseItems(const std::shared_ptr<Stmt>& stmt) const {
+        if (!stmt) return false;
+        if (auto var_decl = std::dynamic_pointer_cast<const VarDeclStmt>(stmt)) {
+            return mayReleaseItems(var_decl->initializer);
+        }
+        if (auto expr_stmt = std::dynamic_pointer_cast<const ExpressionStmt>(stmt)) {
+            return mayReleaseItems(expr_stmt->expression);
+        }
+        if (auto block = std::dynamic_pointer_cast<const BlockStmt>(stmt)) {
+            for (const auto& s : block->statements) {
+                if (mayReleaseItems(s)) return true;
+            }
+            return false;
+        }
+        if (auto if_stmt = std::dynamic_pointer_cast<const IfStmt>(stmt)) {
+            auto condition = if_stmt->declaration ? if_stmt->declaration->initializer : if_stmt->condition;
+            return mayReleaseItems(condition) || mayReleaseItems(if_stmt->thenBranch) ||
+                   mayReleaseItems(if_stmt->elseBranch);
+        }
+        if (auto while_stmt = std::dynamic_pointer_cast<const WhileStmt>(stmt)) {
+            return mayReleaseItems(while_stmt->condition) || mayReleaseItems(while_stmt->body);
+        }
+        if (auto for_stmt = std::dynamic_pointer_cast<const ForStmt>(stmt)) {
+            return mayReleaseItems(for_stmt->initializer) || mayReleaseItems(for_stmt->condition) ||
+                   mayReleaseItems(for_stmt->increment) || mayReleaseItems(for_stmt->body);
+        }
+        if (auto for_in = std::dynamic_pointer_cast<const ForInStmt>(stmt)) {
+            return mayReleaseItems(for_in->collection) || mayReleaseItems(for_in->body);
+        }
+        if (auto ret_stmt = std::dynamic_pointer_cast<const ReturnStmt>(stmt)) {
+            return mayReleaseItems(ret_stmt->value);
+        }
+        if (auto throw_stmt = std::dynamic_pointer_cast<const ThrowStmt>(stmt)) {
+            return mayReleaseItems(throw_stmt->expression);
+        }
+        if (auto try_stmt = std::dynamic_pointer_cast<const TryStmt>(stmt)) {
+            return mayReleaseItems(try_stmt->tryBlock) || mayReleaseItems(try_stmt->catchBlock);
+        }
+        return false;
+    }
+
+    bool OwnershipAnalyzer::mayReleaseItems(const std::shared_ptr<Expr>& expr) const {
+        if (!expr) return false;
+        if (auto call = std::dynamic_pointer_cast<const CallExpr>(expr)) {
+            if (!isTransparentCall(*call)) return true;
+            for (const auto& arg : call->arguments) {
+                if (mayReleaseItems(arg)) return true;
+            }
+            return false;
+        }
+        if (auto assign = std::dynamic_pointer_cast<const AssignExpr>(expr)) {
+            // Overwriting a list element drops the list's reference to it.
+            if (auto subscript = std::dynamic_pointer_cast<const SubscriptExpr>(assign->target)) {
+                auto collection_type = m_type_checker.m_expression_types.at(subscript->object.get());
+                if (collection_type->kind == TypeKind::LIST) return true;
+            }
+            return mayReleaseItems(assign->target) || mayReleaseItems(assign->value);
+        }
+        if (auto grouping = std::dynamic_pointer_cast<const Grouping>(expr)) return mayReleaseItems(grouping->expression);
+        if (auto binary = std::dynamic_pointer_cast<const Binary>(expr)) {
+            return mayReleaseItems(binary->left) || mayReleaseItems(binary->right);
+        }
+        if (auto unary = std::dynamic_pointer_cast<const Unary>(expr)) return mayReleaseItems(unary->right);
+        if (auto logical = std::dynamic_pointer_cast<const LogicalExpr>(expr)) {
+            return mayReleaseItems(logical->left) || mayReleaseItems(logical->right);
+        }
+        if (auto get = std::dynamic_pointer_cast<const GetExpr>(expr)) return mayReleaseItems(get->object);
+        if (auto list = std::dynamic_pointer_cast<const ListExpr>(expr)) {
+            for (const auto& element : list->elements) {
+                if (mayReleaseItems(element)) return true;
+            }
+            return false;
+        }
+        if (auto record = std::dynamic_pointer_cast<const RecordExpr>(expr)) {
+            for (const auto& value : record->values) {
+                if (mayReleaseItems(value)) return true;
+            }
+            return false;
+        }
+        if (auto subscript = std::dynamic_pointer_cast<const SubscriptExpr>(expr)) {
+            return mayReleaseItems(subscript->object) || mayReleaseItems(subscript->index);
+        }
+        if (auto ternary = std::dynamic_pointer_cast<const TernaryExpr>(expr)) {
+            return mayReleaseItems(ternary->condition) || mayReleaseItems(ternary->thenBranch) ||
+                   mayReleaseItems(ternary->elseBranch);
+        }
+        if (auto is_expr = std::dynamic_pointer_cast<const IsExpr>(expr)) return mayReleaseItems(is_expr->object);
+        if (auto match = std::dynamic_pointer_cast<const MatchExpr>(expr)) {
+            if (mayReleaseItems(match->condition)) return true;
+            for (const auto& case_item : match->cases) {
+                if (mayReleaseItems(case_item.body)) return true;
+            }
+            return false;
+        }
+        if (auto retype = std::dynamic_pointer_cast<const RetypeExpr>(expr)) return mayReleaseItems(retype->expression);
+        if (auto interpolated = std::dynamic_pointer_cast<const InterpolatedExpr>(expr)) {
+            for (const auto& part : interpolated->parts) {
+                if (mayReleaseItems(part)) return true;
+            }
+            return false;
+        }
+        return false;
+    }
+
+} // namespace angara
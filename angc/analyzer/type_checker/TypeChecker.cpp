@@ -57,6 +57,7 @@ namespace angara {
         m_type_error = std::make_shared<PrimitiveType>("<error>");
         m_type_thread = std::make_shared<ThreadType>();
         m_type_mutex = std::make_shared<MutexType>();
+        m_type_string_builder = std::make_shared<StringBuilderType>();
         m_module_type = std::make_shared<ModuleType>(module_name);
         m_type_exception = std::make_shared<ExceptionType>();
         m_type_c_ptr = std::make_shared<CPtrType>();
@@ -90,6 +91,27 @@ namespace angara {
             true // spawn itself is variadic
         );
         m_symbols.declare(Token(TokenType::IDENTIFIER, "spawn", 0, 0), spawn_type, true);
+        // `spawn` queues a task on the runtime's worker pool; `spawn_thread` gives the
+        // function an OS thread of its own, for work that blocks for a long time.
+        m_symbols.declare(Token(TokenType::IDENTIFIER, "spawn_thread", 0, 0), spawn_type, true);
+
+        // `region(f, ...)` calls f inside a memory region; its result type comes from f.
+        const auto region_type = std::make_shared<FunctionType>(
+            std::vector<std::shared_ptr<Type>>{std::make_shared<FunctionType>(
+                std::vector<std::shared_ptr<Type>>{}, std::make_shared<AnyType>(), true
+            )},
+            std::make_shared<AnyType>(),
+            true
+        );
+        m_symbols.declare(Token(TokenType::IDENTIFIER, "region", 0, 0), region_type, true);
+
+        // `range(start, end[, step])` counts from start up to (or down to) end, exclusive.
+        const auto range_type = std::make_shared<FunctionType>(
+            std::vector<std::shared_ptr<Type>>{m_type_i64, m_type_i64},
+            std::make_shared<ListType>(m_type_i64),
+            true
+        );
+        m_symbols.declare(Token(TokenType::IDENTIFIER, "range", 0, 0), range_type, true);
 
         auto mutex_constructor_type = std::make_shared<FunctionType>(
             std::vector<std::shared_ptr<Type>>{},
@@ -97,6 +119,13 @@ namespace angara {
         );
         m_symbols.declare(Token(TokenType::IDENTIFIER, "Mutex", 0, 0), mutex_constructor_type, true);
 
+        // `StringBuilder()` collects text with amortized appends; `build()` hands it over as a string.
+        auto string_builder_constructor_type = std::make_shared<FunctionType>(
+            std::vector<std::shared_ptr<Type>>{},
+            m_type_string_builder
+        );
+        m_symbols.declare(Token(TokenType::IDENTIFIER, "StringBuilder", 0, 0), string_builder_constructor_type, true);
+
         // func string(any) -> string
         auto string_conv_type = std::make_shared<FunctionType>(
             std::vector<std::shared_ptr<Type>>{m_type_any}, m_type_string
@@ -347,6 +376,7 @@ std::shared_ptr<Type> TypeChecker::resolveType(const std::shared_ptr<ASTType>& a
         if (name == "c_ptr") return m_type_c_ptr;
         if (name == "Exception") return m_type_exception;
         if (name == "Mutex") return m_type_mutex;
+        if (name == "StringBuilder") return m_type_string_builder;
 
         // Handle the generic `record` keyword as a special built-in type.
         if (name == "record") {
@@ -15,14 +15,29 @@ namespace angara {
         }
         if (m_hadError) { pushAndSave(&expr, m_type_error); return {}; }
 
-        // --- Phase 2: Special Case Dispatch for `spawn` ---
+        // --- Phase 2: Special Case Dispatch for `spawn`, `region` and `range` ---
         if (auto var_expr = std::dynamic_pointer_cast<const VarExpr>(expr.callee)) {
-            if (var_expr->name.lexeme == "spawn") {
-                check_spawn_call(expr, arg_types);
+            if (var_expr->name.lexeme == "spawn" || var_expr->name.lexeme == "spawn_thread") {
+                check_spawn_call(expr, arg_types, var_expr->name.lexeme);
                 // The result type of spawn is always Thread.
                 pushAndSave(&expr, m_hadError ? m_type_error : m_type_thread);
                 return {};
             }
+            if (var_expr->name.lexeme == "region") {
+                check_spawn_call(expr, arg_types, "region");
+                // region(f, ...) evaluates to whatever f returns.
+                std::shared_ptr<Type> result_type = m_type_error;
+                if (!m_hadError) {
+                    result_type = std::dynamic_pointer_cast<FunctionType>(arg_types[0])->return_type;
+                }
+                pushAndSave(&expr, result_type);
+                return {};
+            }
+            if (var_expr->name.lexeme == "range") {
+                check_range_call(expr, arg_types);
+                pushAndSave(&expr, m_hadError ? m_type_error : std::dynamic_pointer_cast<FunctionType>(callee_type)->return_type);
+                return {};
+            }
         }
 
         // --- Phase 3: Main Dispatch based on Callee Type ---
@@ -73,21 +88,23 @@ namespace angara {
         return {};
     }
 
-// A helper for the special-case validation logic for `spawn`.
+// A helper for the special-case validation logic for `spawn` and `region`,
+// which both take a function followed by the arguments to call it with.
     void TypeChecker::check_spawn_call(
             const CallExpr& call,
-            const std::vector<std::shared_ptr<Type>>& arg_types
+            const std::vector<std::shared_ptr<Type>>& arg_types,
+            const std::string& builtin
     ) {
         // Rule 1: spawn() must be called with at least one argument (the function).
         if (arg_types.empty()) {
-            error(call.paren, "spawn() requires at least one argument, the function to execute in the new thread.");
+            error(call.paren, builtin + "() requires at least one argument, the function to execute.");
             return;
         }
 
         // Rule 2: The first argument to spawn() must be a function.
         auto closure_type = arg_types[0];
         if (closure_type->kind != TypeKind::FUNCTION) {
-            error(call.paren, "The first argument to spawn() must be a function, but got a value of type '" + closure_type->toString() + "'.");
+            error(call.paren, "The first argument to " + builtin + "() must be a function, but got a value of type '" + closure_type->toString() + "'.");
             return;
         }
         auto func_type = std::dynamic_pointer_cast<FunctionType>(closure_type);
@@ -98,9 +115,9 @@ namespace angara {
 
         // Rule 3: Check arity for the spawned function.
         if (num_actual_args != num_expected_args) {
-            error(call.paren, "Incorrect number of arguments for the spawned function. "
+            error(call.paren, "Incorrect number of arguments for the function passed to " + builtin + "(). "
                               "The function expects " + std::to_string(num_expected_args) +
-                              " argument(s), but " + std::to_string(num_actual_args) + " were provided to spawn().");
+                              " argument(s), but " + std::to_string(num_actual_args) + " were provided to " + builtin + "().");
 
             // Add a note pointing to the function being spawned, if it's a direct variable.
             if (auto var_expr = std::dynamic_pointer_cast<const VarExpr>(call.arguments[0])) {
@@ -118,7 +135,7 @@ namespace angara {
             const auto& actual_type = arg_types[i + 1];
 
             if (!check_type_compatibility(expected_type, actual_type)) {
-                error(call.paren, "Type mismatch for argument " + std::to_string(i + 1) + " of spawned function. "
+                error(call.paren, "Type mismatch for argument " + std::to_string(i + 1) + " of the function passed to " + builtin + "(). "
                                                                                           "Expected '" + expected_type->toString() + "', but got '" + actual_type->toString() + "'.");
 
                 // Add the same helpful note.
@@ -132,6 +149,22 @@ namespace angara {
         }
     }
 
+// `range` takes a start, an end and an optional step, all integers.
+    void TypeChecker::check_range_call(const CallExpr& call, const std::vector<std::shared_ptr<Type>>& arg_types) {
+        if (arg_types.size() < 2 || arg_types.size() > 3) {
+            error(call.paren, "range() expects 2 or 3 arguments (start, end[, step]), but got " +
+                              std::to_string(arg_types.size()) + ".");
+            return;
+        }
+        for (size_t i = 0; i < arg_types.size(); ++i) {
+            if (!isInteger(arg_types[i])) {
+                error(call.paren, "Argument " + std::to_string(i + 1) + " of range() must be an integer, but got '" +
+                                  arg_types[i]->toString() + "'.");
+                return;
+            }
+        }
+    }
+
 // A helper to validate a standard function or method call against a signature.
     void TypeChecker::check_function_call(
             const CallExpr& call,
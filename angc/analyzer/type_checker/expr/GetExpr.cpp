@@ -167,6 +167,19 @@ std::any TypeChecker::visit(const GetExpr& expr) {
             error(expr.name, "Type 'Mutex' has no property named '" + property_name + "'.");
         }
     }
+    else if (unwrapped_object_type->kind == TypeKind::STRING_BUILDER) {
+        if (property_name == "append") {
+            // Appends the text of any value, exactly as `string(value)` would render it.
+            property_type = std::make_shared<FunctionType>(std::vector<std::shared_ptr<Type>>{m_type_any}, m_type_nil);
+        } else if (property_name == "build") {
+            // Hands the collected text over as a string and leaves the builder empty.
+            property_type = std::make_shared<FunctionType>(std::vector<std::shared_ptr<Type>>{}, m_type_string);
+        } else if (property_name == "clear") {
+            property_type = std::make_shared<FunctionType>(std::vector<std::shared_ptr<Type>>{}, m_type_nil);
+        } else {
+            error(expr.name, "Type 'StringBuilder' has no property named '" + property_name + "'.");
+        }
+    }
     else if (unwrapped_object_type->kind == TypeKind::EXCEPTION) {
         auto exception_type = std::dynamic_pointer_cast<ExceptionType>(unwrapped_object_type);
         auto field_it = exception_type->fields.find(property_name);
@@ -0,0 +1,18 @@
+#include "TypeChecker.h"
+
+namespace angara {
+
+    std::any TypeChecker::visit(const InterpolatedExpr& expr) {
+        // Every embedded expression is converted exactly like `string(x)` would,
+        // so any type is accepted; the result is always a string.
+        bool has_error = false;
+        for (const auto& part : expr.parts) {
+            part->accept(*this);
+            if (popType()->kind == TypeKind::ERROR) has_error = true;
+        }
+
+        pushAndSave(&expr, has_error ? m_type_error : m_type_string);
+        return {};
+    }
+
+} // namespace angara
@@ -79,18 +79,36 @@ namespace angara {
                 }
 
                 // B. Handle destructuring.
-                if (case_item.variable) {
+                //    Each payload value is bound to its own variable; `_` skips one.
+                if (!case_item.variables.empty()) {
                     if (func_type->param_types.empty()) {
-                        error(*case_item.variable, "Variant '" + variant_name + "' has no associated data to bind.");
+                        error(case_item.variables[0], "Variant '" + variant_name + "' has no associated data to bind.");
+                    } else if (case_item.variables.size() != func_type->param_types.size()) {
+                        error(case_item.variables[0], "Variant '" + variant_name + "' carries " +
+                                                      std::to_string(func_type->param_types.size()) + " value(s), but the pattern binds " +
+                                                      std::to_string(case_item.variables.size()) + ".");
                     } else {
-                        auto payload_type = func_type->param_types[0];
-                        m_symbols.declare(*case_item.variable, payload_type, true);
+                        for (size_t i = 0; i < case_item.variables.size(); ++i) {
+                            if (case_item.variables[i].lexeme == "_") continue;
+                            m_symbols.declare(case_item.variables[i], func_type->param_types[i], true);
+                        }
                     }
                 } else {
                     if (!func_type->param_types.empty()) {
                         error(expr.keyword, "Match case for variant '" + variant_name + "' must bind its value to a variable, e.g., 'case " + variant_name + "(x): ...'.");
                     }
                 }
+            } else if (pattern_type->kind == TypeKind::ENUM && std::dynamic_pointer_cast<const GetExpr>(case_item.pattern)) {
+                // A nullary variant, e.g., `WebEvent.PageLoad`, is already a value of its enum.
+                const std::string& variant_name = std::dynamic_pointer_cast<const GetExpr>(case_item.pattern)->name.lexeme;
+                if (pattern_type->toString() != enum_type->name) {
+                    error(expr.keyword, "Variant '" + variant_name + "' does not belong to the enum '" + enum_type->name + "'.");
+                } else {
+                    covered_variants.insert(variant_name);
+                }
+                if (!case_item.variables.empty()) {
+                    error(case_item.variables[0], "Variant '" + variant_name + "' has no associated data to bind.");
+                }
             }
 
             // C. Type check the case's body expression.
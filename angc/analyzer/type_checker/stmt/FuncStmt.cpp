@@ -58,6 +58,7 @@ namespace angara {
                 error(stmt.name, "'export' can only be used on top-level declarations.");
             } else {
                 m_module_type->exports[stmt.name.lexeme] = function_type;
+                if (stmt.name.lexeme != "main") m_module_type->functions.insert(stmt.name.lexeme);
             }
         }
     }
@@ -20,6 +20,12 @@ namespace angara {
                         types_match = true;
                     }
                 }
+                // An empty list literal takes the element type from the annotation.
+                auto list_literal = std::dynamic_pointer_cast<const ListExpr>(stmt->initializer);
+                if (!types_match && list_literal && list_literal->elements.empty() && declared_type->kind == TypeKind::LIST) {
+                    m_expression_types[list_literal.get()] = declared_type;
+                    types_match = true;
+                }
                 if (!types_match) {
                     error(stmt->name, "Type mismatch. Variable is annotated as '" +
                         declared_type->toString() + "' but is initialized with a value of type '" +
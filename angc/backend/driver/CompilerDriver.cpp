@@ -7,6 +7,7 @@
 #include "Lexer.h"
 #include "Parser.h"
 #include "TypeChecker.h"
+#include "OwnershipAnalyzer.h"
 #include "CTranspiler.h"
 #include <iostream>
 #include <fstream>
@@ -270,6 +271,17 @@ bool CompilerDriver::compile(const std::string& root_file_path) {
 
     // Add final flags
     command_ss << " -pthread -lm";
+#ifdef ANGARA_NAN_BOXING
+        // Programs must use the value representation the native modules were built with.
+        command_ss << " -DANGARA_NAN_BOXING";
+#endif
+#ifdef ANGARA_NO_CYCLE_COLLECTOR
+        command_ss << " -DANGARA_NO_CYCLE_COLLECTOR";
+#endif
+#ifdef ANGARA_EXCEPTION_RETURNS
+        // The runtime's angara_throw must match the lowering the transpiler chose.
+        command_ss << " -DANGARA_EXCEPTION_RETURNS";
+#endif
         command_ss << " -Wl,-rpath," << m_native_module_path;
         command_ss << " -O3";
     std::string command = command_ss.str();
@@ -458,7 +470,9 @@ std::string CompilerDriver::get_base_name(const std::string& path) {
             if (!typeChecker.check(statements)) { m_had_error = true; m_compilation_stack.pop_back(); return nullptr; }
             auto module_type_obj = typeChecker.getModuleType();
             m_angara_module_names.push_back(module_name);
-            CTranspiler transpiler(typeChecker, errorHandler);
+            OwnershipAnalyzer ownership(typeChecker);
+            ownership.analyze(statements);
+            CTranspiler transpiler(typeChecker, ownership, errorHandler);
             auto [header_code, source_code] = transpiler.generate(statements, module_type_obj, m_angara_module_names);
             if (errorHandler.hadError()) { m_had_error = true; m_compilation_stack.pop_back(); return nullptr; }
 
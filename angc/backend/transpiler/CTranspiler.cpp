@@ -3,8 +3,9 @@
 
 namespace angara {
 
-    CTranspiler::CTranspiler(TypeChecker& type_checker, ErrorHandler& errorHandler)
-            : m_type_checker(type_checker), m_errorHandler(errorHandler), m_current_out(&m_main_body) {}
+    CTranspiler::CTranspiler(TypeChecker& type_checker, OwnershipAnalyzer& ownership, ErrorHandler& errorHandler)
+            : m_type_checker(type_checker), m_ownership(ownership), m_errorHandler(errorHandler),
+              m_current_out(&m_main_body) {}
 
     TranspileResult CTranspiler::generate(
             const std::vector<std::shared_ptr<Stmt>>& statements,
@@ -14,6 +15,13 @@ namespace angara {
         if (m_hadError) return {};
         const std::string& module_name = module_type->name; // <-- Get the canonical name
         this->m_current_module_name = module_name;
+        for (const auto& stmt : statements) {
+            if (auto data_stmt = std::dynamic_pointer_cast<const DataStmt>(stmt)) {
+                if (!data_stmt->is_foreign) m_data_stmts[data_stmt->name.lexeme] = data_stmt.get();
+            } else if (auto func_stmt = std::dynamic_pointer_cast<const FuncStmt>(stmt)) {
+                if (!func_stmt->is_foreign) m_global_functions[func_stmt->name.lexeme] = func_stmt.get();
+            }
+        }
 
         // --- Pass 0: Handle Attachments ---
         m_current_out = &m_header_out; // write prototypes to the header
@@ -52,7 +60,8 @@ namespace angara {
         std::string header_guard = "ANGARA_GEN_" + module_name + "_H";
         *m_current_out << "#ifndef " << header_guard << "\n";
         *m_current_out << "#define " << header_guard << "\n\n";
-        *m_current_out << "#include \"angara_runtime.h\"\n\n";
+        // The inline header pulls in angara_runtime.h plus the static inline fast paths.
+        *m_current_out << "#include \"angara_inline.h\"\n\n";
         *m_current_out << "#include <stdlib.h>\n\n";
 
         // --- NEW PASS 0a: Generate DATA struct definitions ---
@@ -99,12 +108,18 @@ namespace angara {
         m_indent_level = 0;
 
         *m_current_out << "#include \"" << module_name << ".h\"\n\n";
+        // The string literal pool goes here, once all literals have been seen.
+        const std::string::size_type literal_pool_pos = m_source_out.str().size();
 
         // PASS 2a: Generate DATA constructor helper implementations
         (*m_current_out) << "// --- Data Constructor Implementations ---\n";
         for (const auto& stmt : statements) {
             if (auto data_stmt = std::dynamic_pointer_cast<const DataStmt>(stmt)) {
-                if (!data_stmt->is_foreign) transpileDataConstructor(*data_stmt);
+                if (!data_stmt->is_foreign) {
+                    transpileDataDrop(*data_stmt);
+                    transpileDataTraverse(*data_stmt);
+                    transpileDataConstructor(*data_stmt);
+                }
             }
         }
 
@@ -119,6 +134,8 @@ namespace angara {
         (*m_current_out) << "\n// --- Enum Constructor Implementations ---\n";
         for (const auto& stmt : statements) {
             if (auto enum_stmt = std::dynamic_pointer_cast<const EnumStmt>(stmt)) {
+                transpileEnumDrop(*enum_stmt);
+                transpileEnumTraverse(*enum_stmt);
                 transpileEnumConstructors(*enum_stmt, false /* generate_prototype_only */);
             }
         }
@@ -136,6 +153,7 @@ namespace angara {
         // Assemble the final source file from BOTH the main source stream
         // AND the main body stream.
         std::string final_source = m_source_out.str();
+        final_source.insert(literal_pool_pos, generateLiteralPool(module_name));
         if (main_symbol) {
             final_source += m_main_body.str();
         }
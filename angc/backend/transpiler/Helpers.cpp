@@ -54,10 +54,124 @@ namespace angara {
 
     std::string CTranspiler::getCType(const std::shared_ptr<Type>& angaraType) {
         if (!angaraType) return "void /* unknown type */";
+        // Statically typed numbers and booleans are kept unboxed in plain C values.
+        // They are only boxed when they escape into a dynamic context.
+        if (isInteger(angaraType)) return "int64_t";
+        if (isFloat(angaraType)) return "double";
+        if (angaraType->toString() == "bool") return "bool";
         // All other reference types are AngaraObject.
         return "AngaraObject";
     }
 
+    bool CTranspiler::isUnboxed(const std::shared_ptr<Type>& angaraType) {
+        return angaraType && getCType(angaraType) != "AngaraObject";
+    }
+
+    std::string CTranspiler::packedListElement(const std::shared_ptr<Type>& list_type) {
+        if (!list_type || list_type->kind != TypeKind::LIST) return "";
+        // Lists of numbers and bools keep their elements in the same C representation
+        // as a local of the element type would.
+        auto element_type = std::dynamic_pointer_cast<ListType>(list_type)->element_type;
+        if (isInteger(element_type)) return "i64";
+        if (isFloat(element_type)) return "f64";
+        if (element_type->toString() == "bool") return "bool";
+        return "";
+    }
+
+    std::string CTranspiler::packedListKind(const std::string& element) {
+        if (element == "i64") return "ANGARA_LIST_I64";
+        if (element == "f64") return "ANGARA_LIST_F64";
+        return "ANGARA_LIST_BOOL";
+    }
+
+    std::string CTranspiler::boxValue(const std::string& code, const std::shared_ptr<Type>& type) {
+        if (!isUnboxed(type)) return code;
+        if (isInteger(type)) return "angara_create_i64(" + code + ")";
+        if (isFloat(type)) return "angara_create_f64(" + code + ")";
+        return "angara_create_bool(" + code + ")";
+    }
+
+    std::string CTranspiler::unboxValue(const std::string& code, const std::shared_ptr<Type>& type) {
+        if (!isUnboxed(type)) return code;
+        if (isInteger(type)) return "AS_I64(" + code + ")";
+        if (isFloat(type)) return "AS_F64(" + code + ")";
+        return "AS_BOOL(" + code + ")";
+    }
+
+    std::string CTranspiler::unboxOwned(const std::string& code, const std::shared_ptr<Type>& type) {
+        if (m_counted_integers && isInteger(type)) return "angara_take_i64(" + code + ")";
+        return unboxValue(code, type);
+    }
+
+    std::string CTranspiler::convertValue(const std::string& code,
+                                          const std::shared_ptr<Type>& from,
+                                          const std::shared_ptr<Type>& to) {
+        const std::string from_c = getCType(from);
+        const std::string to_c = getCType(to);
+
+        // 1. Same C representation: nothing to do.
+        if (from_c == to_c) return code;
+
+        // 2. Boxed -> raw, or raw -> boxed.
+        if (from_c == "AngaraObject") return unboxValue(code, to);
+        if (to_c == "AngaraObject") return boxValue(code, from);
+
+        // 3. Raw -> raw (e.g. an i64 operand promoted into a double context).
+        return "((" + to_c + ")(" + code + "))";
+    }
+
+    std::string CTranspiler::defaultValue(const std::shared_ptr<Type>& type) {
+        if (isInteger(type)) return "0";
+        if (isFloat(type)) return "0.0";
+        if (isUnboxed(type)) return "false";
+        return "angara_create_nil()";
+    }
+
+    std::string CTranspiler::transpileExprAs(const std::shared_ptr<Expr>& expr, const std::shared_ptr<Type>& target) {
+        auto expr_type = m_type_checker.m_expression_types.at(expr.get());
+        return convertValue(transpileExpr(expr), expr_type, target);
+    }
+
+    std::string CTranspiler::transpileBoxed(const std::shared_ptr<Expr>& expr) {
+        auto expr_type = m_type_checker.m_expression_types.at(expr.get());
+        return boxValue(transpileExpr(expr), expr_type);
+    }
+
+    std::string CTranspiler::transpileCondition(const std::shared_ptr<Expr>& expr) {
+        // A statically known bool is already a C truth value.
+        auto expr_type = m_type_checker.m_expression_types.at(expr.get());
+        if (expr_type->toString() == "bool") return transpileExpr(expr);
+        TempList temps;
+        std::string value = transpileBorrowed(expr, temps);
+        return releaseTemps("angara_is_truthy(" + value + ")", temps);
+    }
+
+    std::string CTranspiler::transpileStringLiteral(const std::string& text) {
+        // Every occurrence of the same text shares one statically allocated string,
+        // so evaluating a literal never allocates.
+        auto it = m_string_literals.find(text);
+        if (it == m_string_literals.end()) {
+            std::string name = "angara_lit_" + std::to_string(m_string_literals.size());
+            it = m_string_literals.emplace(text, name).first;
+        }
+        return "ANGARA_OBJ_VAL(&" + it->second + ")";
+    }
+
+    std::string CTranspiler::generateLiteralPool(const std::string& module_name) {
+        std::stringstream pool;
+        pool << "// --- String Literal Pool ---\n";
+        for (const auto& [text, name] : m_string_literals) {
+            pool << "static AngaraString " << name << " = ANGARA_STATIC_STRING(\"" << escape_c_string(text) << "\");\n";
+        }
+        // Interning makes literal record keys compare by pointer.
+        pool << "static void Angara_" << module_name << "_intern_literals(void) {\n";
+        for (const auto& [text, name] : m_string_literals) {
+            pool << "    angara_intern_literal(&" << name << ");\n";
+        }
+        pool << "}\n\n";
+        return pool.str();
+    }
+
     std::string CTranspiler::join_strings(const std::vector<std::string>& elements, const std::string& separator) {
         std::stringstream ss;
         for (size_t i = 0; i < elements.size(); ++i) {
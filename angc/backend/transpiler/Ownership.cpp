@@ -0,0 +1,231 @@
+#include <algorithm>
+#include "CTranspiler.h"
+namespace angara {
+
+    // --- Owned and Borrowed Values ---
+
+    bool CTranspiler::yieldsOwnedObject(const std::shared_ptr<Expr>& expr) {
+        auto type = m_type_checker.m_expression_types.at(expr.get());
+        return !isUnboxed(type) && type->kind != TypeKind::NIL && m_ownership.isOwned(expr);
+    }
+
+    std::string CTranspiler::freshTemp(const std::string& prefix) {
+        return prefix + std::to_string(m_temp_counter++);
+    }
+
+    std::string CTranspiler::transpileOwned(const std::shared_ptr<Expr>& expr, const std::shared_ptr<Type>& target) {
+        auto type = m_type_checker.m_expression_types.at(expr.get());
+        std::string code = transpileExprAs(expr, target);
+        if (isUnboxed(target) || isUnboxed(type) || type->kind == TypeKind::NIL) return code;
+        if (m_ownership.ownership(expr) != OwnershipAnalyzer::Ownership::Borrowed) return code;
+
+        // The last read of an owned local hands its reference over instead of taking a
+        // new one; the local is left nil, so dropping it at the end of its scope is free.
+        if (auto var_expr = std::dynamic_pointer_cast<const VarExpr>(expr)) {
+            auto symbol = m_type_checker.m_variable_resolutions.at(var_expr.get());
+            std::string name = transpileVarName(*var_expr);
+            if (symbol->depth > 0 && m_ownership.canMove(*var_expr) && isOwnedLocal(name)) {
+                std::string moved = freshTemp("__moved");
+                return "({ AngaraObject " + moved + " = " + name + "; " + name + " = angara_create_nil(); " + moved + "; })";
+            }
+        }
+        return "angara_retain(" + code + ")";
+    }
+
+    std::string CTranspiler::transpileBorrowed(const std::shared_ptr<Expr>& expr, TempList& temps) {
+        std::string code = transpileBoxed(expr);
+        bool boxes_integer = m_counted_integers && isInteger(m_type_checker.m_expression_types.at(expr.get()));
+        if (!yieldsOwnedObject(expr) && !boxes_integer) return code;
+        std::string name = freshTemp("__tmp");
+        temps.emplace_back(name, code);
+        return name;
+    }
+
+    std::string CTranspiler::transpileBorrowedAs(const std::shared_ptr<Expr>& expr, const std::shared_ptr<Type>& target,
+                                                 TempList& temps) {
+        std::string code = transpileExprAs(expr, target);
+        if (isUnboxed(target) || !yieldsOwnedObject(expr)) return code;
+        std::string name = freshTemp("__tmp");
+        temps.emplace_back(name, code);
+        return name;
+    }
+
+    std::string CTranspiler::transpileArgument(const std::shared_ptr<Expr>& expr, const std::shared_ptr<Type>& param_type,
+                                               bool owned, TempList& temps) {
+        return owned ? transpileOwned(expr, param_type) : transpileBorrowedAs(expr, param_type, temps);
+    }
+
+    std::string CTranspiler::releaseTemps(const std::string& code, const TempList& temps, bool is_void) {
+        if (temps.empty()) return code;
+
+        // ({ AngaraObject __tmp0 = <owned>; __auto_type __result = <code>; angara_decref(__tmp0); __result; })
+        std::stringstream ss;
+        ss << "({ ";
+        for (const auto& [name, init] : temps) {
+            ss << "AngaraObject " << name << " = " << init << "; ";
+        }
+        std::string result = freshTemp("__result");
+        if (is_void) {
+            ss << code << "; ";
+        } else {
+            ss << "__auto_type " << result << " = " << code << "; ";
+        }
+        for (auto it = temps.rbegin(); it != temps.rend(); ++it) {
+            ss << "angara_decref(" << it->first << "); ";
+        }
+        if (!is_void) ss << result << "; ";
+        ss << "})";
+        return ss.str();
+    }
+
+    bool CTranspiler::isOwnedParam(const std::shared_ptr<FunctionType>& type, size_t index) {
+        return type && index < type->owned_params.size() && type->owned_params[index];
+    }
+
+    // --- Drop Scopes ---
+
+    void CTranspiler::enterScope(bool is_loop) {
+        DropScope scope;
+        scope.is_loop = is_loop;
+        m_scopes.push_back(std::move(scope));
+    }
+
+    void CTranspiler::exitScope(bool emit_drops) {
+        if (m_scopes.empty()) return;
+        if (emit_drops) emitDrops(m_scopes.size() - 1);
+        m_scopes.pop_back();
+    }
+
+    void CTranspiler::declareLocal(const std::string& name, bool owned) {
+        if (m_scopes.empty()) return;
+        m_scopes.back().locals.push_back({name, owned});
+        // A throw that unwinds this frame releases the local through its address.
+        if (owned && !m_exception_returns) {
+            indent();
+            (*m_current_out) << "angara_push_local((AngaraObject*)&" << name << ");\n";
+        }
+    }
+
+    void CTranspiler::emitDrops(size_t first_scope, const std::string& except) {
+        size_t pushed = 0;
+        for (size_t i = m_scopes.size(); i-- > first_scope;) {
+            const auto& locals = m_scopes[i].locals;
+            for (auto it = locals.rbegin(); it != locals.rend(); ++it) {
+                if (!it->owned) continue;
+                pushed++;
+                if (it->name == except) continue;
+                indent();
+                (*m_current_out) << "angara_decref(" << it->name << ");\n";
+            }
+            if (!m_scopes[i].try_frame.empty()) {
+                indent();
+                (*m_current_out) << "g_exception_chain_head = " << m_scopes[i].try_frame << ".prev;\n";
+            }
+        }
+        if (pushed > 0 && !m_exception_returns) {
+            indent();
+            (*m_current_out) << "angara_pop_locals(" << pushed << ");\n";
+        }
+    }
+
+    std::string CTranspiler::localName(const Token& name) {
+        std::string c_name = sanitize_name(name.lexeme);
+        bool shadows = false;
+        for (const auto& scope : m_scopes) {
+            for (const auto& local : scope.locals) shadows |= local.name == c_name;
+        }
+        if (!shadows) return c_name;
+        c_name += "_" + std::to_string(name.line) + "_" + std::to_string(name.column);
+        m_local_names[{name.line, name.column, name.lexeme}] = c_name;
+        return c_name;
+    }
+
+    std::string CTranspiler::localName(const Symbol& symbol) {
+        const Token& token = symbol.declaration_token;
+        auto renamed = m_local_names.find({token.line, token.column, token.lexeme});
+        return renamed != m_local_names.end() ? renamed->second : sanitize_name(symbol.name);
+    }
+
+    size_t CTranspiler::innermostLoopScope() const {
+        for (size_t i = m_scopes.size(); i-- > 0;) {
+            if (m_scopes[i].is_loop) return i;
+        }
+        return 0;
+    }
+
+    // --- Exception Returns ---
+
+    std::string CTranspiler::checkException(const std::string& call, bool is_void) {
+        if (!m_exception_returns) return call;
+        std::string propagate = "if (angara_exception_pending()) { " + propagateException() + " }";
+        if (is_void) return "({ " + call + "; " + propagate + " })";
+        std::string result = freshTemp("__checked");
+        return "({ __auto_type " + result + " = " + call + "; " + propagate + " " + result + "; })";
+    }
+
+    std::string CTranspiler::propagateException() {
+        // 1. The innermost `try` body of this function catches the exception.
+        size_t first_scope = 0;
+        std::string catch_label;
+        for (size_t i = m_scopes.size(); i-- > 0;) {
+            if (!m_scopes[i].catch_label.empty()) {
+                first_scope = i;
+                catch_label = m_scopes[i].catch_label;
+                break;
+            }
+        }
+
+        // 2. The owned locals it leaves behind are dropped on the way, as for `return`.
+        std::stringstream drops;
+        std::stringstream* out = m_current_out;
+        int indent_level = m_indent_level;
+        m_current_out = &drops;
+        m_indent_level = 0;
+        emitDrops(first_scope);
+        m_current_out = out;
+        m_indent_level = indent_level;
+        std::string code = drops.str();
+        std::replace(code.begin(), code.end(), '\n', ' ');
+
+        // 3. Without a `try`, the function returns and its caller checks in turn.
+        //    Global initializers run outside any function scope, in a void function.
+        if (!catch_label.empty()) return code + "goto " + catch_label + ";";
+        if (m_scopes.empty()) return code + "return;";
+        return code + "return (" + getCType(m_current_return_type) + "){0};";
+    }
+
+    bool CTranspiler::isOwnedLocal(const std::string& name) const {
+        for (auto scope = m_scopes.rbegin(); scope != m_scopes.rend(); ++scope) {
+            for (auto it = scope->locals.rbegin(); it != scope->locals.rend(); ++it) {
+                if (it->name == name) return it->owned;
+            }
+        }
+        return false;
+    }
+
+    bool CTranspiler::isTerminator(const std::shared_ptr<Stmt>& stmt) {
+        if (auto block = std::dynamic_pointer_cast<const BlockStmt>(stmt)) {
+            return !block->statements.empty() && isTerminator(block->statements.back());
+        }
+        return std::dynamic_pointer_cast<const ReturnStmt>(stmt) || std::dynamic_pointer_cast<const ThrowStmt>(stmt) ||
+               std::dynamic_pointer_cast<const BreakStmt>(stmt);
+    }
+
+    bool CTranspiler::hasSideEffects(const std::shared_ptr<Expr>& expr) {
+        if (std::dynamic_pointer_cast<const Literal>(expr) || std::dynamic_pointer_cast<const VarExpr>(expr) ||
+            std::dynamic_pointer_cast<const ThisExpr>(expr)) {
+            return false;
+        }
+        if (auto grouping = std::dynamic_pointer_cast<const Grouping>(expr)) return hasSideEffects(grouping->expression);
+        if (auto unary = std::dynamic_pointer_cast<const Unary>(expr)) return hasSideEffects(unary->right);
+        if (auto get = std::dynamic_pointer_cast<const GetExpr>(expr)) return hasSideEffects(get->object);
+        if (auto binary = std::dynamic_pointer_cast<const Binary>(expr)) {
+            return hasSideEffects(binary->left) || hasSideEffects(binary->right);
+        }
+        if (auto logical = std::dynamic_pointer_cast<const LogicalExpr>(expr)) {
+            return hasSideEffects(logical->left) || hasSideEffects(logical->right);
+        }
+        return true;
+    }
+
+}
@@ -6,66 +6,186 @@
 namespace angara{
 
     std::string CTranspiler::transpileAssignExpr(const AssignExpr& expr) {
-        auto rhs_str = transpileExpr(expr.value);
-        auto lhs_str = transpileExpr(expr.target);
-
             if (auto subscript_target = std::dynamic_pointer_cast<const SubscriptExpr>(expr.target)) {
                 // This is a special case that doesn't transpile to a simple C assignment.
                 // We must generate a call to a runtime setter function.
 
-                std::string object_str = transpileExpr(subscript_target->object);
-                std::string value_str = transpileExpr(expr.value);
+                // The setters retain the value they store, so every operand is borrowed.
+                // A boxed store throws if a region value cannot be copied out to the collection.
+                TempList temps;
+                std::string object_str = transpileBorrowed(subscript_target->object, temps);
                 auto collection_type = m_type_checker.m_expression_types.at(subscript_target->object.get());
+                std::string packed = packedListElement(collection_type);
+                if (!packed.empty()) {
+                    // Packed lists store the raw C value.
+                    auto element_type = std::dynamic_pointer_cast<ListType>(collection_type)->element_type;
+                    std::string index_str = transpileExprAs(subscript_target->index, m_i64_type);
+                    std::string value_str = transpileExprAs(expr.value, element_type);
+                    return releaseTemps("angara_list_set_" + packed + "(" + object_str + ", " + index_str + ", " + value_str + ")", temps, true);
+                }
+                std::string value_str = transpileBorrowed(expr.value, temps);
 
                 if (collection_type->kind == TypeKind::LIST) {
-                    std::string index_str = transpileExpr(subscript_target->index);
+                    std::string index_str = transpileBorrowed(subscript_target->index, temps);
                     // Generates: angara_list_set(list, index, value);
-                    return "angara_list_set(" + object_str + ", " + index_str + ", " + value_str + ")";
+                    return checkException(releaseTemps("angara_list_set(" + object_str + ", " + index_str + ", " + value_str + ")", temps, true), true);
                 }
 
                 if (collection_type->kind == TypeKind::RECORD) {
-                    std::string index_str = transpileExpr(subscript_target->index);
-                    return "angara_record_set_with_angara_key(" + object_str + ", " + index_str + ", " + value_str + ")";
+                    std::string index_str = transpileBorrowed(subscript_target->index, temps);
+                    return checkException(releaseTemps("angara_record_set_with_angara_key(" + object_str + ", " + index_str + ", " + value_str + ")", temps, true), true);
                 }
 
                 return "/* unsupported subscript assignment */";
             }
 
+        // 1. Resolve the l-value and the C representation it is stored in.
+        //    A variable is written through its declared type, never a narrowed one.
+        std::string lhs_str;
+        std::shared_ptr<Type> target_type;
+        bool is_global_target = false;
+        // For a field of a class or data instance, the instance the field belongs to.
+        TempList owner_temps;
+        std::string field_owner;
+        if (auto var_target = std::dynamic_pointer_cast<const VarExpr>(expr.target)) {
+            lhs_str = transpileVarName(*var_target);
+            auto symbol = m_type_checker.m_variable_resolutions.at(var_target.get());
+            target_type = symbol->type;
+            is_global_target = symbol->depth == 0;
+        } else {
+            lhs_str = transpileExpr(expr.target);
+            target_type = m_type_checker.m_expression_types.at(expr.target.get());
+            if (auto get_target = std::dynamic_pointer_cast<const GetExpr>(expr.target)) {
+                auto owner_type = m_type_checker.m_expression_types.at(get_target->object.get());
+                auto data_type = std::dynamic_pointer_cast<DataType>(owner_type);
+                if (owner_type->kind == TypeKind::INSTANCE || (data_type && !data_type->is_foreign)) {
+                    field_owner = transpileBorrowed(get_target->object, owner_temps);
+                }
+            }
+        }
+        // The value a boxed target ends up holding: globals are visible to every thread,
+        // and a field must not point into a region its instance outlives. Either may
+        // have to copy a region value out, which throws if it cannot.
+        auto storedValue = [&](const std::string& value) {
+            if (is_global_target) return "angara_share(" + value + ")";
+            if (!field_owner.empty()) return "angara_field_store_value(" + field_owner + ", " + value + ")";
+            return value;
+        };
+        // The check comes before the old value is dropped, so a failed store leaves it in place.
+        auto checkStore = [&](const std::string& code) {
+            return is_global_target || !field_owner.empty() ? checkException(code, false) : code;
+        };
+        auto result_type = m_type_checker.m_expression_types.at(&expr);
+
         if (expr.op.type == TokenType::EQUAL) {
             // Simple assignment: x = y
-            return "(" + lhs_str + " = " + rhs_str + ")";
+            if (isUnboxed(target_type)) {
+                std::string rhs_str = transpileExprAs(expr.value, target_type);
+                return convertValue("(" + lhs_str + " = " + rhs_str + ")", target_type, result_type);
+            }
+            if (!is_global_target && isOwnedLocal(lhs_str) && m_ownership.isReuseSite(expr)) {
+                return convertValue(transpileReuseAssign(expr, lhs_str), target_type, result_type);
+            }
+            // The target owns its value: take a reference to the new one before dropping
+            // the old one, which may be what the right-hand side was computed from.
+            std::string rhs_str = checkStore(storedValue(transpileOwned(expr.value, target_type)));
+            std::string new_value = freshTemp("__new");
+            std::string assign_str = "({ AngaraObject " + new_value + " = " + rhs_str + "; angara_decref(" + lhs_str + "); " +
+                                     lhs_str + " = " + new_value + "; })";
+            return convertValue(releaseTemps(assign_str, owner_temps), target_type, result_type);
         } else {
             // Compound assignment: x += y, x -= y, etc.
             // This desugars to: x = x + y
 
-            // 1. Get the core operator string (e.g., "+" from "+=").
+            // 2. Get the core operator string (e.g., "+" from "+=").
             std::string core_op = expr.op.lexeme;
             core_op.pop_back(); // Remove the trailing '='
 
-            // 2. Get the type of the LHS to generate the correct unboxing/reboxing.
-            auto target_type = m_type_checker.m_expression_types.at(expr.target.get());
-
             // 3. Assemble the C expression.
             std::string full_expression;
-            if (isInteger(target_type)) {
-                // e.g., create_i64((AS_I64(x) + AS_I64(y)))
+            if (isNumeric(target_type)) {
+                // The target is a raw C number: x += y is exactly the C compound operator.
+                std::string rhs_str = transpileExprAs(expr.value, target_type);
+                if (core_op == "%" && isFloat(target_type)) {
+                    full_expression = "(" + lhs_str + " = fmod(" + lhs_str + ", " + rhs_str + "))";
+                } else {
+                    full_expression = "(" + lhs_str + " " + expr.op.lexeme + " " + rhs_str + ")";
+                }
+                return convertValue(full_expression, target_type, result_type);
+            }
+
+            TempList temps;
+            std::string rhs_str = transpileBorrowed(expr.value, temps);
+            auto value_type = m_type_checker.m_expression_types.at(expr.value.get());
+            if (isInteger(value_type)) {
+                // A boxed target (e.g. `any`) updated with an integer.
                 full_expression = "angara_create_i64((AS_I64(" + lhs_str + ") " + core_op + " AS_I64(" + rhs_str + ")))";
-            } else if (isFloat(target_type)) {
-                // e.g., create_f64((AS_F64(x) + AS_F64(y)))
+            } else if (isFloat(value_type)) {
                 // Note: This correctly handles the case where one is an int and one is a float
                 // because our AS_F64 macro performs the promotion.
                 full_expression = "angara_create_f64((AS_F64(" + lhs_str + ") " + core_op + " AS_F64(" + rhs_str + ")))";
             } else if (target_type->toString() == "string" && expr.op.type == TokenType::PLUS_EQUAL) {
-                // String concatenation: x = angara_string_concat(x, y)
-                full_expression = "angara_string_concat(" + lhs_str + ", " + rhs_str + ")";
+                // The target hands its reference over to the append, which grows the string
+                // in place when nothing else refers to it, so `s += x` in a loop stays linear.
+                std::string appended = storedValue("angara_string_append(" + lhs_str + ", " + rhs_str + ")");
+                temps.insert(temps.begin(), owner_temps.begin(), owner_temps.end());
+                return convertValue(checkStore(releaseTemps("(" + lhs_str + " = " + appended + ")", temps)), target_type, result_type);
             } else {
                 // Should be unreachable if the Type Checker is correct.
                 full_expression = "angara_create_nil() /* unsupported compound assignment */";
             }
 
-            // 4. Return the full assignment expression.
-            return "(" + lhs_str + " = " + full_expression + ")";
+            full_expression = checkStore(storedValue(full_expression));
+            temps.insert(temps.begin(), owner_temps.begin(), owner_temps.end());
+
+            // 4. Return the full assignment expression. The new value is computed from the
+            //    old one, which is dropped only afterwards.
+            std::string new_value = freshTemp("__new");
+            std::string assign_str = "({ AngaraObject " + new_value + " = " + full_expression + "; angara_decref(" +
+                                     lhs_str + "); " + lhs_str + " = " + new_value + "; })";
+            return convertValue(releaseTemps(assign_str, temps), target_type, result_type);
         }
     }
 
-}
\ No newline at end of file
+    std::string CTranspiler::transpileReuseAssign(const AssignExpr& expr, const std::string& lhs_str) {
+        // `x = Data(...)` where `x` owns the only reference to its data object: the new
+        // fields are written over the old ones instead of allocating a fresh object.
+        auto value = expr.value;
+        while (auto grouping = std::dynamic_pointer_cast<const Grouping>(value)) value = grouping->expression;
+        auto call = std::dynamic_pointer_cast<const CallExpr>(value);
+        auto data_type = std::dynamic_pointer_cast<DataType>(m_type_checker.m_expression_types.at(call->callee.get()));
+        const DataStmt& data_stmt = *m_data_stmts.at(data_type->name);
+        std::string c_struct_name = "Angara_" + data_type->name;
+
+        std::stringstream ss;
+        ss << "({ ";
+
+        // 1. Evaluate the new field values first; they may still read the old object.
+        std::vector<std::string> field_temps;
+        for (size_t i = 0; i < call->arguments.size(); ++i) {
+            auto field_type = data_type->fields.at(data_stmt.fields[i]->name.lexeme).type;
+            std::string temp = freshTemp("__field");
+            ss << getCType(field_type) << " " << temp << " = " << transpileOwned(call->arguments[i], field_type) << "; ";
+            field_temps.push_back(temp);
+        }
+
+        // 2. Reuse the object in place when nobody else can observe it...
+        std::string data = freshTemp("__data");
+        ss << "if (angara_is_unique(" << lhs_str << ")) { "
+           << c_struct_name << "* " << data << " = (" << c_struct_name << "*)AS_OBJ(" << lhs_str << "); ";
+        for (size_t i = 0; i < data_stmt.fields.size(); ++i) {
+            std::string field_name = sanitize_name(data_stmt.fields[i]->name.lexeme);
+            auto field_type = data_type->fields.at(data_stmt.fields[i]->name.lexeme).type;
+            if (!isUnboxed(field_type)) ss << "angara_decref(" << data << "->" << field_name << "); ";
+            ss << data << "->" << field_name << " = " << field_temps[i] << "; ";
+        }
+
+        // 3. ...and fall back to a fresh allocation when it is shared.
+        std::string fresh = freshTemp("__new");
+        ss << "} else { AngaraObject " << fresh << " = Angara_data_new_" << data_type->name << "("
+           << join_strings(field_temps, ", ") << "); angara_decref(" << lhs_str << "); "
+           << lhs_str << " = " << fresh << "; } " << lhs_str << "; })";
+        return ss.str();
+    }
+
+}
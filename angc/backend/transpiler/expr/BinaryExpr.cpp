@@ -8,63 +8,60 @@ std::string CTranspiler::transpileBinary(const Binary& expr) {
 
     if (isNumeric(lhs_type) && isNumeric(rhs_type)) {
         bool result_is_float = isFloat(lhs_type) || isFloat(rhs_type);
-        std::string lhs_str;
-        std::string rhs_str;
-
-        // --- CORRECT, TYPE-AWARE UNBOXING ---
-        // Unbox the left-hand side based on its actual type.
-        if (auto lit = std::dynamic_pointer_cast<const Literal>(expr.left)) {
-            lhs_str = lit->token.lexeme;
-        } else {
-            lhs_str = result_is_float ? "AS_F64(" + transpileExpr(expr.left) + ")"
-                                      : "AS_I64(" + transpileExpr(expr.left) + ")";
-        }
 
-        // Unbox the right-hand side based on its actual type.
-        if (auto lit = std::dynamic_pointer_cast<const Literal>(expr.right)) {
-            rhs_str = lit->token.lexeme;
-        } else {
-            rhs_str = result_is_float ? "AS_F64(" + transpileExpr(expr.right) + ")"
-                                      : "AS_I64(" + transpileExpr(expr.right) + ")";
-        }
-        // --- END CORRECTION ---
+        // --- UNBOXED FAST PATH ---
+        // Numeric operands are already raw C values (int64_t / double), so the
+        // operation maps straight onto a C operator. Mixed operands are promoted
+        // to double, exactly like the type checker's result type.
+        auto operand_type = result_is_float ? m_f64_type : m_i64_type;
+        std::string lhs_str = transpileExprAs(expr.left, operand_type);
+        std::string rhs_str = transpileExprAs(expr.right, operand_type);
 
         switch (expr.op.type) {
             case TokenType::PLUS:
             case TokenType::MINUS:
             case TokenType::STAR:
             case TokenType::SLASH:
-                if (result_is_float) {
-                    return "angara_create_f64(" + lhs_str + " " + op + " " + rhs_str + ")";
-                } else {
-                    return "angara_create_i64(" + lhs_str + " " + op + " " + rhs_str + ")";
-                }
+                return "(" + lhs_str + " " + op + " " + rhs_str + ")";
 
             case TokenType::PERCENT:
                  if (result_is_float) {
-                    return "angara_create_f64(fmod(" + lhs_str + ", " + rhs_str + "))";
-                } else {
-                    // Use explicit casts to int64_t for safety with literals.
-                    return "angara_create_i64(((int64_t)(" + lhs_str + ")) % ((int64_t)(" + rhs_str + ")))";
+                    return "fmod(" + lhs_str + ", " + rhs_str + ")";
                 }
+                return "(" + lhs_str + " % " + rhs_str + ")";
 
             case TokenType::GREATER:
             case TokenType::GREATER_EQUAL:
             case TokenType::LESS:
             case TokenType::LESS_EQUAL:
-                 // Comparisons are safer when promoted to double.
-                 if (!isFloat(lhs_type)) lhs_str = "AS_I64(" + transpileExpr(expr.left) + ")";
-                 if (!isFloat(rhs_type)) rhs_str = "AS_I64(" + transpileExpr(expr.right) + ")";
-                 return "angara_create_bool((double)" + lhs_str + " " + op + " (double)" + rhs_str + ")";
+            case TokenType::EQUAL_EQUAL:
+            case TokenType::BANG_EQUAL:
+                return "(" + lhs_str + " " + op + " " + rhs_str + ")";
 
             default:
                 break;
         }
     }
 
+    // Two statically typed booleans compare as plain C values.
+    if ((expr.op.type == TokenType::EQUAL_EQUAL || expr.op.type == TokenType::BANG_EQUAL) &&
+        lhs_type->toString() == "bool" && rhs_type->toString() == "bool") {
+        return "(" + transpileExpr(expr.left) + " " + op + " " + transpileExpr(expr.right) + ")";
+    }
+
+    // A string `+` chain, e.g. `"fib(" + string(n) + ") = " + string(r)`, is built in one go.
+    if (expr.op.type == TokenType::PLUS && lhs_type->toString() == "string" && rhs_type->toString() == "string") {
+        std::vector<std::shared_ptr<Expr>> pieces;
+        collectStringPieces(expr.left, pieces);
+        collectStringPieces(expr.right, pieces);
+        return transpileStringPieces(pieces);
+    }
+
     // --- FALLBACK PATH for Equality, String Concat, and other non-optimizable operations ---
-    std::string lhs_str = transpileExpr(expr.left);
-    std::string rhs_str = transpileExpr(expr.right);
+    // Operands that produce a new reference are dropped once the operation is done.
+    TempList temps;
+    std::string lhs_str = transpileBorrowed(expr.left, temps);
+    std::string rhs_str = transpileBorrowed(expr.right, temps);
 
     switch (expr.op.type) {
         case TokenType::EQUAL_EQUAL:
@@ -75,22 +72,22 @@ std::string CTranspiler::transpileBinary(const Binary& expr) {
                 std::string equals_func = c_struct_name + "_equals";
                 std::string ptr_a = "((" + c_struct_name + "*)AS_OBJ(" + lhs_str + "))";
                 std::string ptr_b = "((" + c_struct_name + "*)AS_OBJ(" + rhs_str + "))";
-                result_str = "angara_create_bool(" + equals_func + "(" + ptr_a + ", " + ptr_b + "))";
+                result_str = equals_func + "(" + ptr_a + ", " + ptr_b + ")";
+            } else if (lhs_type->toString() == "string" && rhs_type->toString() == "string") {
+                // Two strings skip the generic dispatch on the value type.
+                result_str = "angara_string_equals(AS_STRING(" + lhs_str + "), AS_STRING(" + rhs_str + "))";
             } else {
-                result_str = "angara_equals(" + lhs_str + ", " + rhs_str + ")";
+                result_str = "AS_BOOL(angara_equals(" + lhs_str + ", " + rhs_str + "))";
             }
 
             if (expr.op.type == TokenType::BANG_EQUAL) {
-                return "angara_create_bool(!AS_BOOL(" + result_str + "))";
+                return releaseTemps("(!" + result_str + ")", temps);
             }
-            return result_str;
+            return releaseTemps(result_str, temps);
         }
 
         case TokenType::PLUS:
-            if (lhs_type->toString() == "string" && rhs_type->toString() == "string") {
-                return "angara_string_concat(" + lhs_str + ", " + rhs_str + ")";
-            }
-            // The numeric case for '+' was handled in the optimization path above.
+            // The numeric and string cases for '+' were handled in the paths above.
             // If we reach here, it's an unhandled + operation that should have been a type error.
             break;
 
@@ -101,4 +98,52 @@ std::string CTranspiler::transpileBinary(const Binary& expr) {
     return "angara_create_nil() /* unhandled binary op */";
 }
 
-}
\ No newline at end of file
+void CTranspiler::collectStringPieces(const std::shared_ptr<Expr>& expr, std::vector<std::shared_ptr<Expr>>& pieces) {
+    auto inner = expr;
+    while (auto grouping = std::dynamic_pointer_cast<const Grouping>(inner)) inner = grouping->expression;
+
+    if (auto binary = std::dynamic_pointer_cast<const Binary>(inner)) {
+        if (binary->op.type == TokenType::PLUS &&
+            m_type_checker.m_expression_types.at(binary->left.get())->toString() == "string" &&
+            m_type_checker.m_expression_types.at(binary->right.get())->toString() == "string") {
+            collectStringPieces(binary->left, pieces);
+            collectStringPieces(binary->right, pieces);
+            return;
+        }
+    }
+    if (auto interpolated = std::dynamic_pointer_cast<const InterpolatedExpr>(inner)) {
+        for (const auto& part : interpolated->parts) collectStringPieces(part, pieces);
+        return;
+    }
+    // `string(x)` needs no string of its own: the runtime writes the text of `x` in place.
+    if (auto call = std::dynamic_pointer_cast<const CallExpr>(inner)) {
+        auto var_expr = std::dynamic_pointer_cast<const VarExpr>(call->callee);
+        if (var_expr && var_expr->name.lexeme == "string" && call->arguments.size() == 1) {
+            auto symbol = m_type_checker.m_variable_resolutions.at(var_expr.get());
+            // Built-in functions are declared without a source position.
+            if (symbol && !symbol->from_module && symbol->declaration_token.line == 0) {
+                pieces.push_back(call->arguments[0]);
+                return;
+            }
+        }
+    }
+    pieces.push_back(expr);
+}
+
+std::string CTranspiler::transpileStringPieces(const std::vector<std::shared_ptr<Expr>>& pieces) {
+    // Every piece is borrowed; the runtime copies its text into the result.
+    TempList temps;
+    std::vector<std::string> piece_strs;
+    for (const auto& piece : pieces) piece_strs.push_back(transpileBorrowed(piece, temps));
+
+    bool plain_pair = pieces.size() == 2 &&
+                      m_type_checker.m_expression_types.at(pieces[0].get())->toString() == "string" &&
+                      m_type_checker.m_expression_types.at(pieces[1].get())->toString() == "string";
+    if (plain_pair) {
+        return releaseTemps("angara_string_concat(" + piece_strs[0] + ", " + piece_strs[1] + ")", temps);
+    }
+    return releaseTemps("angara_string_concat_n(" + std::to_string(pieces.size()) + ", (AngaraObject[]){" +
+                        join_strings(piece_strs, ", ") + "})", temps);
+}
+
+}
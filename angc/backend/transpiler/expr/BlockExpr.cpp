@@ -7,9 +7,13 @@ namespace angara {
     void CTranspiler::transpileBlock(const BlockStmt& stmt) {
         indent(); (*m_current_out) << "{\n";
         m_indent_level++;
+        enterScope();
         for (const auto& s : stmt.statements) {
             transpileStmt(s);
         }
+        // Owned locals are dropped when control falls off the end of the block;
+        // return and break drop them on their own way out.
+        exitScope(stmt.statements.empty() || !isTerminator(stmt.statements.back()));
         m_indent_level--;
         indent(); (*m_current_out) << "}\n";
     }
@@ -1,41 +1,128 @@
 //
 // Created by cv2 on 9/19/25.
 //
+#include <algorithm>
 #include "CTranspiler.h"
 namespace angara {
 
     std::string CTranspiler::transpileCallExpr(const CallExpr& expr) {
-        // 1. Transpile all arguments first, as they are needed in almost every case.
-        std::vector<std::string> arg_strs;
-        for (const auto& arg : expr.arguments) {
-            arg_strs.push_back(transpileExpr(arg));
-        }
-        std::string args_str = CTranspiler::join_strings(arg_strs, ", ");
+        // Callees borrow their arguments unless they take ownership of a parameter.
+        // Borrowed arguments that produce a new reference are parked in temporaries,
+        // which `finish` drops once the call has returned. Built-ins that cannot
+        // throw pass `may_throw = false` to skip the pending-exception check.
+        TempList temps;
+        auto finish = [&](const std::string& call_str, bool is_void = false, bool may_throw = true) {
+            std::string code = releaseTemps(call_str, temps, is_void);
+            return may_throw ? checkException(code, is_void) : code;
+        };
+
+        // 1. Arguments for the generic (argc, argv) calling convention are boxed.
+        //    They are transpiled on demand, as typed calls need them in another form.
+        auto boxed_args = [&]() {
+            std::vector<std::string> arg_strs;
+            for (const auto& arg : expr.arguments) {
+                arg_strs.push_back(transpileBorrowed(arg, temps));
+            }
+            return CTranspiler::join_strings(arg_strs, ", ");
+        };
+
+        // Strongly-typed C functions take their arguments in their declared C representation,
+        // passing an owned reference for each parameter the callee takes ownership of.
+        auto typed_args = [&](const std::vector<std::shared_ptr<Type>>& param_types,
+                              const std::shared_ptr<FunctionType>& callee, bool all_owned = false) {
+            std::vector<std::string> typed_strs;
+            for (size_t i = 0; i < expr.arguments.size(); ++i) {
+                typed_strs.push_back(i < param_types.size()
+                    ? transpileArgument(expr.arguments[i], param_types[i], all_owned || isOwnedParam(callee, i), temps)
+                    : transpileBorrowed(expr.arguments[i], temps));
+            }
+            return CTranspiler::join_strings(typed_strs, ", ");
+        };
+
+        // Generic calls return a boxed AngaraObject; unwrap it to this call's static type.
+        auto result_type = m_type_checker.m_expression_types.at(&expr);
+        auto from_boxed = [&](const std::string& call_str) {
+            return unboxOwned(call_str, result_type);
+        };
+
+        // Statically known Angara functions are called through their strongly-typed C
+        // implementation, skipping the closure, the argument array and the arity check.
+        // C leaves the order of a call's arguments unspecified, so when one of them has side
+        // effects each is evaluated into a temporary first, in source order, together with
+        // the temporaries it borrows from; those are dropped once the call has returned.
+        auto direct_call = [&](const std::string& mangled_name, const std::shared_ptr<FunctionType>& func_type) {
+            bool sequenced = expr.arguments.size() > 1 &&
+                std::any_of(expr.arguments.begin(), expr.arguments.end(),
+                            [](const auto& arg) { return hasSideEffects(arg); });
+            if (!sequenced) {
+                std::string call_str = mangled_name + "(" + typed_args(func_type->param_types, func_type) + ")";
+                return finish(convertValue(call_str, func_type->return_type, result_type));
+            }
+
+            // ({ __auto_type __arg0 = a(); AngaraObject __tmp1 = b(); __auto_type __arg2 = __tmp1; ... })
+            std::stringstream ss;
+            TempList arg_temps;
+            std::vector<std::string> arg_names;
+            ss << "({ ";
+            for (size_t i = 0; i < expr.arguments.size(); ++i) {
+                size_t first_temp = arg_temps.size();
+                std::string arg_str = i < func_type->param_types.size()
+                    ? transpileArgument(expr.arguments[i], func_type->param_types[i], isOwnedParam(func_type, i), arg_temps)
+                    : transpileBorrowed(expr.arguments[i], arg_temps);
+                for (size_t t = first_temp; t < arg_temps.size(); ++t) {
+                    ss << "AngaraObject " << arg_temps[t].first << " = " << arg_temps[t].second << "; ";
+                }
+                arg_names.push_back(freshTemp("__arg"));
+                ss << "__auto_type " << arg_names.back() << " = " << arg_str << "; ";
+            }
+            std::string result = freshTemp("__result");
+            std::string call_str = mangled_name + "(" + join_strings(arg_names, ", ") + ")";
+            ss << "__auto_type " << result << " = " << convertValue(call_str, func_type->return_type, result_type) << "; ";
+            for (auto it = arg_temps.rbegin(); it != arg_temps.rend(); ++it) {
+                ss << "angara_decref(" << it->first << "); ";
+            }
+            ss << result << "; })";
+            return finish(ss.str());
+        };
 
         auto callee_type = m_type_checker.m_expression_types.at(expr.callee.get());
 
         // Case 1: The callee is a property access, e.g., `object.method(...)`.
         // This is the most complex case, covering methods and module functions.
         if (auto get_expr = std::dynamic_pointer_cast<const GetExpr>(expr.callee)) {
-            std::string object_str = transpileExpr(get_expr->object);
+            std::string object_str = transpileBorrowed(get_expr->object, temps);
             const std::string& name = get_expr->name.lexeme;
             auto object_type = m_type_checker.m_expression_types.at(get_expr->object.get());
 
             // A) Method call on a built-in primitive type. This has the highest priority.
             if (object_type->kind == TypeKind::THREAD && name == "join") {
-                return "angara_thread_join(" + object_str + ")";
+                return finish(from_boxed("angara_thread_join(" + object_str + ")"));
             }
             if (object_type->kind == TypeKind::MUTEX && (name == "lock" || name == "unlock")) {
-                return "angara_mutex_" + name + "(" + object_str + ")";
+                return finish("angara_mutex_" + name + "(" + object_str + ")", true, false);
+            }
+            if (object_type->kind == TypeKind::STRING_BUILDER) {
+                if (name == "build") return finish("angara_string_builder_build(" + object_str + ")", false, false);
+                if (name == "append") {
+                    return finish("angara_string_builder_append(" + object_str + ", " + boxed_args() + ")", true, false);
+                }
+                return finish("angara_string_builder_" + name + "(" + object_str + ")", true, false);
             }
             if (object_type->kind == TypeKind::LIST) {
-                if (name == "push") return "angara_list_push(" + object_str + ", " + args_str + ")";
-                if (name == "remove_at") return "angara_list_remove_at(" + object_str + ", " + args_str + ")"; // <-- ADD THIS
-                if (name == "remove") return "angara_list_remove(" + object_str + ", " + args_str + ")"; // <-- ADD THIS
+                std::string packed = packedListElement(object_type);
+                if (name == "push" && !packed.empty()) {
+                    auto element_type = std::dynamic_pointer_cast<ListType>(object_type)->element_type;
+                    return finish("angara_list_push_" + packed + "(" + object_str + ", " +
+                                  transpileExprAs(expr.arguments[0], element_type) + ")", true, false);
+                }
+                // A boxed push copies region values out to the list, which can throw.
+                if (name == "push") return finish("angara_list_push(" + object_str + ", " + boxed_args() + ")", true);
+                if (name == "remove_at") return finish(from_boxed("angara_list_remove_at(" + object_str + ", " + boxed_args() + ")")); // <-- ADD THIS
+                if (name == "remove") return finish(from_boxed("angara_list_remove(" + object_str + ", " + boxed_args() + ")")); // <-- ADD THIS
             }
             if (object_type->kind == TypeKind::RECORD) { // <-- ADD THIS BLOCK
-                if (name == "remove") return "angara_record_remove(" + object_str + ", " + args_str + ")";
-                if (name == "keys") return "angara_record_keys(" + object_str + ")";
+                if (name == "remove") return finish(from_boxed("angara_record_remove(" + object_str + ", " + boxed_args() + ")"));
+                if (name == "keys") return finish("angara_record_keys(" + object_str + ")", false, false);
             }
 
 
@@ -56,14 +143,17 @@ namespace angara {
                 if (owner_class->is_native) {
                     // NATIVE METHOD: Transpile to a generic (argc, argv) call with `self` as the first argument.
                     // The mangled name is Angara_ClassName_MethodName, using the OWNER's name.
+                    std::string args_str = boxed_args();
                     std::string final_args = object_str + (args_str.empty() ? "" : ", " + args_str);
-                    return "Angara_" + owner_class->name + "_" + name + "(" +
-                           std::to_string(expr.arguments.size() + 1) + ", (AngaraObject[]){" + final_args + "})";
+                    return finish(from_boxed("Angara_" + owner_class->name + "_" + name + "(" +
+                           std::to_string(expr.arguments.size() + 1) + ", (AngaraObject[]){" + final_args + "})"));
                 } else {
                     // ANGARA METHOD: Transpile to a direct, strongly-typed C call.
                     // The mangled name is Angara_ClassName_MethodName, using the OWNER's name.
-                    std::string final_args = object_str + (args_str.empty() ? "" : ", " + args_str);
-                    return "Angara_" + owner_class->name + "_" + name + "(" + final_args + ")";
+                    auto method_type = std::dynamic_pointer_cast<FunctionType>(owner_class->methods.at(name).type);
+                    std::string method_args = typed_args(method_type->param_types, method_type);
+                    std::string final_args = object_str + (method_args.empty() ? "" : ", " + method_args);
+                    return finish("Angara_" + owner_class->name + "_" + name + "(" + final_args + ")");
                 }
             }
 
@@ -73,11 +163,15 @@ namespace angara {
                 std::string mangled_name = "Angara_" + module_type->name + "_" + name;
                 if (module_type->is_native) {
                     // NATIVE GLOBAL FUNCTION or NATIVE CONSTRUCTOR: Always use generic call.
-                    return mangled_name + "(" + std::to_string(expr.arguments.size()) + ", (AngaraObject[]){" + args_str + "})";
+                    return finish(from_boxed(mangled_name + "(" + std::to_string(expr.arguments.size()) + ", (AngaraObject[]){" + boxed_args() + "})"));
+                } else if (module_type->functions.count(name)) {
+                    // ANGARA function from another module: its prototype is in the module's header.
+                    return direct_call("angara_f_" + module_type->name + "_" + name,
+                                       std::dynamic_pointer_cast<FunctionType>(module_type->exports.at(name)));
                 } else {
-                    // ANGARA symbol from another module: Call its global closure.
+                    // Any other ANGARA symbol from another module: Call its global closure.
                     std::string closure_var = "g_" + name;
-                    return "angara_call(" + closure_var + ", " + std::to_string(expr.arguments.size()) + ", (AngaraObject[]){" + args_str + "})";
+                    return finish(from_boxed("angara_call(" + closure_var + ", " + std::to_string(expr.arguments.size()) + ", (AngaraObject[]){" + boxed_args() + "})"));
                 }
             }
 
@@ -87,8 +181,9 @@ namespace angara {
                     // This is an enum variant constructor call.
                     // The `transpileGetExpr` on the callee (`WebEvent.KeyPress`) has already
                     // produced the correct C function name (e.g., `Angara_WebEvent_KeyPress`).
+                    // The variant stores its payload, so it takes ownership of every argument.
                     std::string c_constructor_name = transpileExpr(expr.callee);
-                    return c_constructor_name + "(" + args_str + ")";
+                    return finish(c_constructor_name + "(" + typed_args(func_type->param_types, func_type, true) + ")");
                 }
             }
         }
@@ -102,75 +197,123 @@ namespace angara {
             if (symbol && symbol->from_module && symbol->from_module->is_native) {
                 // It's a native function! Generate the correct mangled call.
                 std::string mangled_name = "Angara_" + symbol->from_module->name + "_" + name;
-                return mangled_name + "(" + std::to_string(expr.arguments.size()) + ", (AngaraObject[]){" + args_str + "})";
+                return finish(from_boxed(mangled_name + "(" + std::to_string(expr.arguments.size()) + ", (AngaraObject[]){" + boxed_args() + "})"));
             }
 
 
             // A) Check for BUILT-IN global functions first.
-            if (name == "len") return "angara_len(" + args_str + ")";
-            if (name == "typeof") return "angara_typeof(" + args_str + ")";
-            if (name == "string") return "angara_to_string(" + args_str + ")";
-            if (name == "i64" || name == "int") return "angara_to_i64(" + args_str + ")";
-            if (name == "f64" || name == "float") return "angara_to_f64(" + args_str + ")";
-            if (name == "bool") return "angara_to_bool(" + args_str + ")";
+            if (name == "len") return finish("AS_I64(angara_len(" + boxed_args() + "))", false, false);
+            if (name == "typeof") return finish("angara_typeof(" + boxed_args() + ")", false, false);
+            if (name == "string") return finish("angara_to_string(" + boxed_args() + ")", false, false);
+            if (name == "i64" || name == "int" || name == "f64" || name == "float" || name == "bool") {
+                // Conversions between raw numbers are plain C casts; anything else
+                // (strings, `any`) goes through the runtime's parsing helpers.
+                auto arg_type = m_type_checker.m_expression_types.at(expr.arguments[0].get());
+                if (isUnboxed(arg_type) && name != "bool") {
+                    return convertValue(transpileExpr(expr.arguments[0]), arg_type, result_type);
+                }
+                if (name == "i64" || name == "int") return finish(from_boxed("angara_to_i64(" + boxed_args() + ")"));
+                if (name == "f64" || name == "float") return finish(from_boxed("angara_to_f64(" + boxed_args() + ")"));
+                return finish(from_boxed("angara_to_bool(" + boxed_args() + ")"));
+            }
+            if (name == "range") {
+                std::string step_str = expr.arguments.size() > 2 ? transpileExprAs(expr.arguments[2], m_i64_type) : "INT64_C(1)";
+                return "angara_range(" + transpileExprAs(expr.arguments[0], m_i64_type) + ", " +
+                       transpileExprAs(expr.arguments[1], m_i64_type) + ", " + step_str + ")";
+            }
             if (name == "Mutex") return "angara_mutex_new()";
-            if (name == "Exception") return "angara_exception_new(" + args_str + ")";
-            if (name == "spawn") {
-                std::string closure_str = transpileExpr(expr.arguments[0]);
+            if (name == "StringBuilder") return "angara_string_builder_new()";
+            if (name == "Exception") return finish("angara_exception_new(" + boxed_args() + ")", false, false);
+            if (name == "spawn" || name == "spawn_thread" || name == "region") {
+                std::string closure_str = transpileBorrowed(expr.arguments[0], temps);
                 std::vector<std::string> rest_arg_strs;
                 for (size_t i = 1; i < expr.arguments.size(); ++i) {
-                    rest_arg_strs.push_back(transpileExpr(expr.arguments[i]));
+                    rest_arg_strs.push_back(transpileBorrowed(expr.arguments[i], temps));
                 }
                 std::string rest_args_str = join_strings(rest_arg_strs, ", ");
-                return "angara_spawn_thread(" + closure_str + ", " + std::to_string(rest_arg_strs.size()) + ", (AngaraObject[]){" + rest_args_str + "})";
+                std::string call_args = closure_str + ", " + std::to_string(rest_arg_strs.size()) + ", (AngaraObject[]){" + rest_args_str + "}";
+                if (name == "region") return finish(from_boxed("angara_region_run(" + call_args + ")"));
+                if (name == "spawn_thread") return finish("angara_spawn_thread(" + call_args + ")");
+                return finish("angara_spawn_task(" + call_args + ")");
             }
 
             if (symbol && symbol->type->kind == TypeKind::FUNCTION) {
                 auto func_type = std::dynamic_pointer_cast<FunctionType>(symbol->type);
                 if (func_type->is_foreign) {
                     std::stringstream call_ss;
+                    auto return_type = func_type->return_type;
+                    bool box_return = return_type->kind != TypeKind::NIL && !isUnboxed(return_type);
 
-                    // 1. Box the return value from the raw C type.
-                    if (func_type->return_type->kind != TypeKind::NIL) {
-                        // e.g., angara_from_c_i32(...)
-                        call_ss << "angara_from_c_" << func_type->return_type->toString() << "(";
+                    // 1. Box the return value from the raw C type. Numbers and bools stay raw.
+                    if (box_return) {
+                        // e.g., angara_from_c_string(...)
+                        call_ss << "angara_from_c_" << return_type->toString() << "(";
+                    } else if (isUnboxed(return_type)) {
+                        call_ss << "((" << getCType(return_type) << ")";
                     }
 
                     // 2. Generate the direct C function call.
                     call_ss << name << "(";
-                    for (size_t i = 0; i < arg_strs.size(); ++i) {
-                        // 3. Unbox the AngaraObject arguments to their raw C types.
-                        // e.g., angara_as_c_string(...)
-                        call_ss << "angara_as_c_" << func_type->param_types[i]->toString() << "(" << arg_strs[i] << ")";
-                        if (i < arg_strs.size() - 1) {
+                    for (size_t i = 0; i < expr.arguments.size(); ++i) {
+                        auto param_type = func_type->param_types[i];
+                        if (isUnboxed(param_type)) {
+                            // 3a. Raw numbers are simply cast to the exact C parameter type.
+                            call_ss << "(" << getRawCType(param_type) << ")" << transpileExprAs(expr.arguments[i], param_type);
+                        } else {
+                            // 3b. Unbox the AngaraObject arguments to their raw C types.
+                            // e.g., angara_as_c_string(...)
+                            call_ss << "angara_as_c_" << param_type->toString() << "(" << transpileBorrowed(expr.arguments[i], temps) << ")";
+                        }
+                        if (i < expr.arguments.size() - 1) {
                             call_ss << ", ";
                         }
                     }
                     call_ss << ")";
 
-                    if (func_type->return_type->kind != TypeKind::NIL) {
+                    if (box_return || isUnboxed(return_type)) {
                         call_ss << ")"; // Close the boxing function call
                     }
-                    return call_ss.str();
+                    return finish(call_ss.str(), return_type->kind == TypeKind::NIL);
                 }
             }
 
             if (callee_type->kind == TypeKind::DATA) {
                 auto data_type = std::dynamic_pointer_cast<DataType>(callee_type);
-                return "Angara_data_new_" + data_type->name + "(" + args_str + ")";
+                // The data object stores its fields, so it takes ownership of every argument.
+                return finish("Angara_data_new_" + data_type->name + "(" +
+                              typed_args(data_type->constructor_type->param_types, data_type->constructor_type, true) + ")");
             }
 
             // B) Check if it's an ANGARA CLASS CONSTRUCTOR.
             if (callee_type->kind == TypeKind::CLASS) {
-                return "Angara_" + name + "_new(" + args_str + ")";
+                auto class_type = std::dynamic_pointer_cast<ClassType>(callee_type);
+                auto init_it = class_type->methods.find("init");
+                if (init_it == class_type->methods.end()) {
+                    return "Angara_" + name + "_new()";
+                }
+                // `_new` forwards its arguments to `init`, so it owns what `init` owns.
+                auto init_type = std::dynamic_pointer_cast<FunctionType>(init_it->second.type);
+                return finish("Angara_" + name + "_new(" + typed_args(init_type->param_types, init_type) + ")");
             }
 
-            // C) If not a built-in or constructor, it's an ANGARA GLOBAL FUNCTION. Call via closure.
-            std::string closure_var = "g_" + name;
-            if (name == "main") closure_var = "g_angara_main_closure";
-            return "angara_call(" + closure_var + ", " + std::to_string(expr.arguments.size()) + ", (AngaraObject[]){" + args_str + "})";
-
+            // C) If not a built-in or constructor, it's an ANGARA GLOBAL FUNCTION.
+            if (symbol && symbol->depth == 0) {
+                auto func_type = std::dynamic_pointer_cast<FunctionType>(symbol->type);
+                if (symbol->from_module && symbol->from_module->functions.count(name)) {
+                    return direct_call("angara_f_" + symbol->from_module->name + "_" + name, func_type);
+                }
+                if (!symbol->from_module && m_global_functions.count(name)) {
+                    return direct_call(name == "main" ? "angara_f_main" : "angara_f_" + m_current_module_name + "_" + name, func_type);
+                }
+            }
 
+            // D) Any other global holding a function is called via its closure. A local
+            //    one is a plain variable and takes the dynamic path below.
+            if (!symbol || symbol->depth == 0) {
+                std::string closure_var = "g_" + name;
+                if (name == "main") closure_var = "g_angara_main_closure";
+                return finish(from_boxed("angara_call(" + closure_var + ", " + std::to_string(expr.arguments.size()) + ", (AngaraObject[]){" + boxed_args() + "})"));
+            }
         }
 
             if (auto super_expr = std::dynamic_pointer_cast<const SuperExpr>(expr.callee)) {
@@ -186,20 +329,28 @@ namespace angara {
                 auto current_class_type = std::dynamic_pointer_cast<ClassType>(current_class_symbol->type);
                 auto superclass_type = current_class_type->superclass;
 
+                // The parent's C function is strongly typed, so pass arguments in its parameter types.
+                const std::string method_name = super_expr->method ? super_expr->method->lexeme : "init";
+                const ClassType* owner_class = findPropertyOwner(superclass_type.get(), method_name);
+                std::string super_args;
+                if (owner_class) {
+                    auto method_type = std::dynamic_pointer_cast<FunctionType>(owner_class->methods.at(method_name).type);
+                    super_args = typed_args(method_type->param_types, method_type);
+                }
+
                 if (!super_expr->method) {
                     // Case A: Constructor call `super(...)`. Transpiles to a call to the parent's `init`.
                     // The first argument is `this_obj`, which is always in scope inside a method.
-                    return "Angara_" + superclass_type->name + "_init(this_obj" + (args_str.empty() ? "" : ", " + args_str) + ")";
+                    return finish("Angara_" + superclass_type->name + "_init(this_obj" + (super_args.empty() ? "" : ", " + super_args) + ")");
                 } else {
                     // Case B: Regular method call `super.method(...)`.
-                    const std::string& method_name = super_expr->method->lexeme;
                     // Transpiles to a direct call to the parent's C method function.
-                    return "Angara_" + superclass_type->name + "_" + method_name + "(this_obj" + (args_str.empty() ? "" : ", " + args_str) + ")";
+                    return finish("Angara_" + superclass_type->name + "_" + method_name + "(this_obj" + (super_args.empty() ? "" : ", " + super_args) + ")");
                 }
             }
 
         // Case 3: Fallback for dynamic calls (e.g., calling a function stored in a variable).
-        std::string callee_str = transpileExpr(expr.callee);
-        return "angara_call(" + callee_str + ", " + std::to_string(expr.arguments.size()) + ", (AngaraObject[]){" + args_str + "})";
+        std::string callee_str = transpileBorrowed(expr.callee, temps);
+        return finish(from_boxed("angara_call(" + callee_str + ", " + std::to_string(expr.arguments.size()) + ", (AngaraObject[]){" + boxed_args() + "})"));
     }
-}
\ No newline at end of file
+}
@@ -5,9 +5,18 @@
 namespace angara{
 
     std::string CTranspiler::transpileGetExpr(const GetExpr& expr) {
-        // 1. Transpile the object on the left of the operator.
-        std::string object_str = transpileExpr(expr.object);
+        // 1. Transpile the object on the left of the operator. An object we own only lives
+        //    until the access is done, so a boxed field read from it takes its own reference.
+        TempList temps;
+        std::string object_str = transpileBorrowed(expr.object, temps);
         const std::string& prop_name = expr.name.lexeme;
+        auto finish = [&](std::string value_str, bool retain) {
+            if (temps.empty()) return value_str;
+            if (retain && !isUnboxed(m_type_checker.m_expression_types.at(&expr))) {
+                value_str = "angara_retain(" + value_str + ")";
+            }
+            return releaseTemps(value_str, temps);
+        };
 
         // 2. Get the pre-computed type of the object from the Type Checker.
         auto object_type = m_type_checker.m_expression_types.at(expr.object.get());
@@ -34,14 +43,16 @@ namespace angara{
                     // The access path: (wrapper_struct*)->ptr->field_name
                     std::string raw_access = "((struct " + c_struct_name + "*)AS_OBJ(" + object_str + "))->ptr->" + prop_name;
 
-                    // Box the raw C value back into an AngaraObject.
-                    std::string boxing_func = "angara_from_c_" + field_type->toString();
+                    // Numbers and bools are used raw; everything else is boxed into an AngaraObject.
+                    std::string value_str = isUnboxed(field_type)
+                        ? "((" + getCType(field_type) + ")" + raw_access + ")"
+                        : "angara_from_c_" + field_type->toString() + "(" + raw_access + ")";
 
                     // Handle optional chaining
                     if (expr.op.type == TokenType::QUESTION_DOT || object_type->kind == TypeKind::OPTIONAL) {
-                        return "(IS_NIL(" + object_str + ") ? angara_create_nil() : " + boxing_func + "(" + raw_access + "))";
+                        return finish("(IS_NIL(" + object_str + ") ? angara_create_nil() : " + boxValue(value_str, field_type) + ")", false);
                     }
-                    return boxing_func + "(" + raw_access + ")";
+                    return finish(value_str, false);
                 }
             }
             // --- END OF NEW LOGIC ---
@@ -49,7 +60,7 @@ namespace angara{
             // If it's not a foreign data type, it must be a regular one.
             // Fall through to the original logic for regular Angara 'data' field access.
             std::string c_struct_name = "Angara_" + unwrapped_object_type->toString();
-            return "((struct " + c_struct_name + "*)AS_OBJ(" + object_str + "))->" + sanitize_name(prop_name);
+            access_str = "((struct " + c_struct_name + "*)AS_OBJ(" + object_str + "))->" + sanitize_name(prop_name);
         }
         else if (unwrapped_object_type->kind == TypeKind::INSTANCE) {
             access_str = transpileGetExpr_on_instance(expr, object_str);
@@ -70,9 +81,9 @@ namespace angara{
                 auto variant_constructor_type = variant_it->second;
 
                 // If the constructor function takes no parameters, it's a nullary variant.
-                // When used as a value, we must transpile it to an immediate C function call.
+                // Its value is the variant's one preallocated instance.
                 if (variant_constructor_type->param_types.empty()) {
-                    return "Angara_" + enum_type->name + "_" + prop_name + "()";
+                    return "ANGARA_OBJ_VAL(&" + enumSingletonName(enum_type->name, prop_name) + ")";
                 }
             }
 
@@ -94,12 +105,17 @@ namespace angara{
         // An access is considered optional if the `?.` operator was used, OR if the
         // object being accessed was an optional type to begin with.
         if (expr.op.type == TokenType::QUESTION_DOT || object_type->kind == TypeKind::OPTIONAL) {
+            // The result is an optional, so a raw field value must be boxed first.
+            auto result_type = m_type_checker.m_expression_types.at(&expr);
+            if (result_type->kind == TypeKind::OPTIONAL) {
+                access_str = boxValue(access_str, std::dynamic_pointer_cast<OptionalType>(result_type)->wrapped_type);
+            }
             // Generates the C ternary: (IS_NIL(obj) ? create_nil() : <the_actual_access>)
-            return "(IS_NIL(" + object_str + ") ? angara_create_nil() : " + access_str + ")";
+            return finish("(IS_NIL(" + object_str + ") ? angara_create_nil() : " + access_str + ")", true);
         }
 
         // 6. If it was a regular access, return the raw access string.
-        return access_str;
+        return finish(access_str, true);
     }
 
     std::string CTranspiler::transpileGetExpr_on_instance(const GetExpr& expr, const std::string& object_str) {
@@ -0,0 +1,11 @@
+#include "CTranspiler.h"
+namespace angara {
+
+    std::string CTranspiler::transpileInterpolatedExpr(const InterpolatedExpr& expr) {
+        // "fib(\(n)) = \(r)" is built exactly like "fib(" + string(n) + ") = " + string(r).
+        std::vector<std::shared_ptr<Expr>> pieces;
+        for (const auto& part : expr.parts) collectStringPieces(part, pieces);
+        return transpileStringPieces(pieces);
+    }
+
+}
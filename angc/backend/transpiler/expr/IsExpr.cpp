@@ -5,7 +5,10 @@
 namespace angara {
 
     std::string CTranspiler::transpileIsExpr(const IsExpr& expr) {
-        std::string object_str = transpileExpr(expr.object);
+        // The runtime checks work on boxed values and yield a boxed bool,
+        // which is unwrapped into a plain C bool.
+        TempList temps;
+        std::string object_str = transpileBorrowed(expr.object, temps);
 
         // Check if the type being checked is a generic `list`.
         if (auto generic_type = std::dynamic_pointer_cast<const GenericType>(expr.type)) {
@@ -15,21 +18,21 @@ namespace angara {
                     auto element_type_ast = generic_type->arguments[0];
                     if (auto simple_element_type = std::dynamic_pointer_cast<const SimpleType>(element_type_ast)) {
                         std::string element_type_name = simple_element_type->name.lexeme;
-                        return "angara_is_list_of_type(" + object_str + ", \"" + element_type_name + "\")";
+                        return releaseTemps("AS_BOOL(angara_is_list_of_type(" + object_str + ", \"" + element_type_name + "\"))", temps);
                     }
                 }
             }
             // Fallback for other generics like 'record' if we add them later.
-            return "angara_is_instance_of(" + object_str + ", \"" + generic_type->name.lexeme + "\")";
+            return releaseTemps("AS_BOOL(angara_is_instance_of(" + object_str + ", \"" + generic_type->name.lexeme + "\"))", temps);
         }
 
         // Fallback for simple types (e.g., `is string`, `is Counter`).
         if (auto simple_type = std::dynamic_pointer_cast<const SimpleType>(expr.type)) {
             std::string type_name_str = simple_type->name.lexeme;
-            return "angara_is_instance_of(" + object_str + ", \"" + type_name_str + "\")";
+            return releaseTemps("AS_BOOL(angara_is_instance_of(" + object_str + ", \"" + type_name_str + "\"))", temps);
         }
 
-        return "angara_create_bool(false)"; // Should be unreachable
+        return "false"; // Should be unreachable
     }
 
 }
\ No newline at end of file
@@ -5,20 +5,35 @@
 namespace angara {
 
     std::string CTranspiler::transpileListExpr(const ListExpr& expr) {
+        // A list of numbers or bools copies the raw values into packed storage.
+        auto list_type = m_type_checker.m_expression_types.at(&expr);
+        std::string packed = packedListElement(list_type);
         if (expr.elements.empty()) {
-            return "angara_list_new()";
+            return packed.empty() ? "angara_list_new()" : "angara_list_new_packed(" + packedListKind(packed) + ", 0, NULL)";
+        }
+        if (!packed.empty()) {
+            auto element_type = std::dynamic_pointer_cast<ListType>(list_type)->element_type;
+            std::string storage_type = packed == "i64" ? "int64_t" : packed == "f64" ? "double" : "uint8_t";
+            std::vector<std::string> values;
+            for (const auto& element : expr.elements) {
+                values.push_back(transpileExprAs(element, element_type));
+            }
+            return "angara_list_new_packed(" + packedListKind(packed) + ", " + std::to_string(expr.elements.size()) +
+                   ", (" + storage_type + "[]){" + join_strings(values, ", ") + "})";
         }
 
+        // The new list retains its elements, so each one is only borrowed here.
+        TempList temps;
         std::stringstream elements_ss;
         for (size_t i = 0; i < expr.elements.size(); ++i) {
-            elements_ss << transpileExpr(expr.elements[i]);
+            elements_ss << transpileBorrowed(expr.elements[i], temps);
             if (i < expr.elements.size() - 1) {
                 elements_ss << ", ";
             }
         }
-        return "angara_list_new_with_elements(" +
-               std::to_string(expr.elements.size()) + ", " +
-               "(AngaraObject[]){" + elements_ss.str() + "})";
+        return releaseTemps("angara_list_new_with_elements(" +
+                            std::to_string(expr.elements.size()) + ", " +
+                            "(AngaraObject[]){" + elements_ss.str() + "})", temps);
     }
 
 }
\ No newline at end of file
@@ -6,11 +6,12 @@ namespace angara {
 
     std::string CTranspiler::transpileLiteral(const Literal& expr) {
         auto type = m_type_checker.m_expression_types.at(&expr);
-        if (type->toString() == "i64") return "angara_create_i64(" + expr.token.lexeme + "LL)";
-        if (type->toString() == "f64") return "angara_create_f64(" + expr.token.lexeme + ")";
-        if (type->toString() == "bool") return "angara_create_bool(" + expr.token.lexeme + ")";
+        // Numeric and boolean literals are emitted as raw C constants.
+        if (type->toString() == "i64") return "INT64_C(" + expr.token.lexeme + ")";
+        if (type->toString() == "f64") return "((double)" + expr.token.lexeme + ")";
+        if (type->toString() == "bool") return expr.token.lexeme;
         if (type->toString() == "string") {
-            return "angara_string_from_c(\"" + escape_c_string(expr.token.lexeme) + "\")";
+            return transpileStringLiteral(expr.token.lexeme);
         }
         if (type->toString() == "nil") return "angara_create_nil()";
         return "angara_create_nil() /* unknown literal */";
@@ -7,16 +7,30 @@ namespace angara {
     std::string CTranspiler::transpileLogical(const LogicalExpr& expr) {
         // --- Handle Nil Coalescing Operator `??` ---
         if (expr.op.type == TokenType::QUESTION_QUESTION) {
-            std::string lhs_str = transpileExpr(expr.left);
-            std::string rhs_str = transpileExpr(expr.right);
-            // Generates: (!IS_NIL(lhs) ? lhs : rhs)
-            return "(!IS_NIL(" + lhs_str + ") ? " + lhs_str + " : " + rhs_str + ")";
+            // The optional lhs is always boxed; the result is the unwrapped type.
+            auto result_type = m_type_checker.m_expression_types.at(&expr);
+            std::string lhs_str = transpileBoxed(expr.left);
+            std::string lhs_value = m_ownership.isOwned(expr.left) ? unboxOwned("__coalesce_lhs", result_type)
+                                                                   : unboxValue("__coalesce_lhs", result_type);
+            std::string rhs_str;
+            if (!isUnboxed(result_type) && (m_ownership.isOwned(expr.left) || m_ownership.isOwned(expr.right))) {
+                // One side hands out a new reference, so both must.
+                if (!m_ownership.isOwned(expr.left)) lhs_value = "angara_retain(" + lhs_value + ")";
+                rhs_str = transpileOwned(expr.right, result_type);
+            } else {
+                rhs_str = transpileExprAs(expr.right, result_type);
+            }
+            // Generates: ({ AngaraObject tmp = lhs; !IS_NIL(tmp) ? tmp : rhs; })
+            // The lhs is evaluated exactly once, as it may be a call.
+            return "({ AngaraObject __coalesce_lhs = " + lhs_str + "; !IS_NIL(__coalesce_lhs) ? " +
+                   lhs_value + " : " + rhs_str + "; })";
         }
 
         // --- logic for `&&` and `||` ---
-        std::string lhs = "angara_is_truthy(" + transpileExpr(expr.left) + ")";
-        std::string rhs = "angara_is_truthy(" + transpileExpr(expr.right) + ")";
-        return "angara_create_bool((" + lhs + ") " + expr.op.lexeme + " (" + rhs + "))";
+        // Both sides are plain C truth values, so C's short-circuiting applies directly.
+        std::string lhs = transpileCondition(expr.left);
+        std::string rhs = transpileCondition(expr.right);
+        return "((" + lhs + ") " + expr.op.lexeme + " (" + rhs + "))";
     }
 
 }
\ No newline at end of file
@@ -8,20 +8,33 @@ namespace angara {
 
     std::string CTranspiler::transpileMatchExpr(const MatchExpr& expr) {
         auto condition_type = m_type_checker.m_expression_types.at(expr.condition.get());
+        auto result_type = m_type_checker.m_expression_types.at(&expr);
         std::string enum_c_name = "Angara_" + condition_type->toString();
 
+        // The bindings borrow from the matched value, which is dropped after the match
+        // when we own it, so any result that is not a constant is handed out owned.
+        bool owned_result = false;
+        for (const auto& case_item : expr.cases) {
+            owned_result |= m_ownership.ownership(case_item.body) != OwnershipAnalyzer::Ownership::Static;
+        }
+        owned_result &= !isUnboxed(result_type);
+        auto case_body = [&](const std::shared_ptr<Expr>& body) {
+            return owned_result ? transpileOwned(body, result_type) : transpileExprAs(body, result_type);
+        };
+
         std::stringstream ss;
         ss << "({ "; // Start GCC/Clang statement expression
         ss << "AngaraObject __match_val = " << transpileExpr(expr.condition) << "; ";
-        ss << "AngaraObject __match_result; ";
-        ss << "switch (((" << enum_c_name << "*)AS_OBJ(__match_val))->tag) { ";
+        ss << enum_c_name << "* __match_obj = (" << enum_c_name << "*)AS_OBJ(__match_val); ";
+        ss << getCType(result_type) << " __match_result; ";
+        ss << "switch (__match_obj->tag) { ";
 
         for (const auto& case_item : expr.cases) {
             // Handle the wildcard case `_`
             if (auto var_expr = std::dynamic_pointer_cast<const VarExpr>(case_item.pattern)) {
                 if (var_expr->name.lexeme == "_") {
                     ss << "default: { ";
-                    ss << "__match_result = " << transpileExpr(case_item.body) << "; ";
+                    ss << "__match_result = " << case_body(case_item.body) << "; ";
                     ss << "break; } ";
                     continue;
                 }
@@ -32,18 +45,27 @@ namespace angara {
                 const std::string& variant_name = get_expr->name.lexeme;
                 ss << "case " << enum_c_name << "_Tag_" << variant_name << ": { ";
 
-                // Handle destructuring
-                if (case_item.variable) {
-                    ss << "AngaraObject " << sanitize_name(case_item.variable->lexeme) << " = ";
-                    ss << "((" << enum_c_name << "*)AS_OBJ(__match_val))->payload." << sanitize_name(variant_name) << "; ";
+                // Handle destructuring: each binding reads its payload field in place,
+                // with the field's C type, so unboxed fields stay unboxed.
+                enterScope();
+                auto enum_type = std::dynamic_pointer_cast<EnumType>(condition_type);
+                const auto& payload_types = enum_type->variants.at(variant_name)->param_types;
+                for (size_t i = 0; i < case_item.variables.size(); ++i) {
+                    if (case_item.variables[i].lexeme == "_") continue;
+                    std::string binding = localName(case_item.variables[i]);
+                    ss << getCType(payload_types[i]) << " " << binding << " = "
+                       << "__match_obj->payload." << enumPayloadField(variant_name, i) << "; ";
+                    declareLocal(binding, false);
                 }
 
-                ss << "__match_result = " << transpileExpr(case_item.body) << "; ";
+                ss << "__match_result = " << case_body(case_item.body) << "; ";
+                exitScope(false);
                 ss << "break; } ";
             }
         }
 
         ss << "} ";
+        if (yieldsOwnedObject(expr.condition)) ss << "angara_decref(__match_val); ";
         ss << "__match_result; "; // The last statement is the value of the expression
         ss << "})"; // End statement expression
         return ss.str();
@@ -9,18 +9,20 @@ namespace angara {
             return "angara_record_new()";
         }
 
+        // The new record retains its values, so each one is only borrowed here.
+        TempList temps;
         std::stringstream kvs_ss;
         for (size_t i = 0; i < expr.keys.size(); ++i) {
-            kvs_ss << "angara_string_from_c(\"" << escape_c_string(expr.keys[i].lexeme) << "\")";
+            kvs_ss << transpileStringLiteral(expr.keys[i].lexeme);
             kvs_ss << ", ";
-            kvs_ss << transpileExpr(expr.values[i]);
+            kvs_ss << transpileBorrowed(expr.values[i], temps);
             if (i < expr.keys.size() - 1) {
                 kvs_ss << ", ";
             }
         }
-        return "angara_record_new_with_fields(" +
-               std::to_string(expr.keys.size()) + ", " +
-               "(AngaraObject[]){" + kvs_ss.str() + "})";
+        return releaseTemps("angara_record_new_with_fields(" +
+                            std::to_string(expr.keys.size()) + ", " +
+                            "(AngaraObject[]){" + kvs_ss.str() + "})", temps);
     }
 
 }
\ No newline at end of file
@@ -11,7 +11,8 @@ namespace angara {
         // to wrap the raw c_ptr in the correct Angara wrapper struct.
 
         // 1. Transpile the inner expression (the c_ptr).
-        std::string inner_expr_str = transpileExpr(expr.expression);
+        TempList temps;
+        std::string inner_expr_str = transpileBorrowed(expr.expression, temps);
 
         // 2. Get the semantic type of the target wrapper.
         auto target_type = m_type_checker.resolveType(expr.target_type);
@@ -20,7 +21,7 @@ namespace angara {
         std::string c_wrapper_name = "Angara_" + target_type->toString();
 
         // 4. Generate the call to the runtime helper.
-        return "angara_retype_c_ptr(" + inner_expr_str + ", sizeof(struct " + c_wrapper_name + "))";
+        return releaseTemps("angara_retype_c_ptr(" + inner_expr_str + ", sizeof(struct " + c_wrapper_name + "))", temps);
     }
 
 } // namespace angara
\ No newline at end of file
@@ -17,8 +17,8 @@ namespace angara {
         // 2. Get the corresponding C type name.
         std::string c_type_name = getCTypeNameForSizeof(resolved_type);
 
-        // 3. Generate the C `sizeof` expression and box the result into a u64 AngaraObject.
-        return "angara_from_c_u64(sizeof(" + c_type_name + "))";
+        // 3. Generate the C `sizeof` expression as a raw u64 value.
+        return "((int64_t)sizeof(" + c_type_name + "))";
     }
 
 } // namespace angara
\ No newline at end of file
@@ -8,18 +8,30 @@ namespace angara {
     std::string CTranspiler::transpileSubscriptExpr(const SubscriptExpr& expr) {
         // 1. Get the pre-computed type of the object being accessed.
         auto collection_type = m_type_checker.m_expression_types.at(expr.object.get());
-        std::string object_str = transpileExpr(expr.object);
+        TempList temps;
+        std::string object_str = transpileBorrowed(expr.object, temps);
 
-        // 2. Dispatch based on the collection's type.
+        // 2. Collections store boxed values; unbox the element to its static type.
+        auto element_type = m_type_checker.m_expression_types.at(&expr);
+
+        // 3. Dispatch based on the collection's type.
         if (collection_type->kind == TypeKind::LIST) {
-            std::string index_str = transpileExpr(expr.index);
-            return "angara_list_get(" + object_str + ", " + index_str + ")";
+            std::string packed = packedListElement(collection_type);
+            if (!packed.empty()) {
+                // Packed lists are read in their raw C representation.
+                auto stored_type = std::dynamic_pointer_cast<ListType>(collection_type)->element_type;
+                std::string get_str = "angara_list_get_" + packed + "(" + object_str + ", " +
+                                      transpileExprAs(expr.index, m_i64_type) + ")";
+                return releaseTemps(convertValue(get_str, stored_type, element_type), temps);
+            }
+            std::string index_str = transpileBorrowed(expr.index, temps);
+            return releaseTemps(unboxOwned("angara_list_get(" + object_str + ", " + index_str + ")", element_type), temps);
         }
 
         if (collection_type->kind == TypeKind::RECORD) {
-            std::string index_str = transpileExpr(expr.index);
+            std::string index_str = transpileBorrowed(expr.index, temps);
             // This now works for both literals (which become Angara strings) and variables.
-            return "angara_record_get_with_angara_key(" + object_str + ", " + index_str + ")";
+            return releaseTemps(unboxOwned("angara_record_get_with_angara_key(" + object_str + ", " + index_str + ")", element_type), temps);
         }
 
         // Fallback if the type checker somehow let a non-subscriptable type through.
@@ -5,9 +5,17 @@
 namespace angara {
 
     std::string CTranspiler::transpileTernary(const TernaryExpr& expr) {
-        std::string cond_str = "angara_is_truthy(" + transpileExpr(expr.condition) + ")";
-        std::string then_str = transpileExpr(expr.thenBranch);
-        std::string else_str = transpileExpr(expr.elseBranch);
+        auto result_type = m_type_checker.m_expression_types.at(&expr);
+        std::string cond_str = transpileCondition(expr.condition);
+        std::string then_str, else_str;
+        if (!isUnboxed(result_type) && (m_ownership.isOwned(expr.thenBranch) || m_ownership.isOwned(expr.elseBranch))) {
+            // One branch hands out a new reference, so both must.
+            then_str = transpileOwned(expr.thenBranch, result_type);
+            else_str = transpileOwned(expr.elseBranch, result_type);
+        } else {
+            then_str = transpileExprAs(expr.thenBranch, result_type);
+            else_str = transpileExprAs(expr.elseBranch, result_type);
+        }
 
         // C's ternary operator is a perfect match.
         return "(" + cond_str + " ? " + then_str + " : " + else_str + ")";
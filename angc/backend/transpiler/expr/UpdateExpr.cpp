@@ -7,26 +7,30 @@ namespace angara {
 
     std::string CTranspiler::transpileUpdate(const UpdateExpr& expr) {
         // We can only increment/decrement variables, which are valid l-values.
-        // The C code needs to pass the ADDRESS of the variable to the runtime helper.
-        std::string target_str = transpileExpr(expr.target);
+        // The Type Checker guarantees the target is a VarExpr.
+        auto var_target = std::dynamic_pointer_cast<const VarExpr>(expr.target);
+        auto declared_type = m_type_checker.m_variable_resolutions.at(var_target.get())->type;
+        auto result_type = m_type_checker.m_expression_types.at(&expr);
+        std::string target_str = transpileVarName(*var_target);
+        const std::string& op = expr.op.lexeme;
+
+        // Fast path: the variable is held as a raw C number, so C's own ++/-- applies.
+        if (isUnboxed(declared_type)) {
+            std::string update_str = expr.isPrefix ? "(" + op + target_str + ")" : "(" + target_str + op + ")";
+            return convertValue(update_str, declared_type, result_type);
+        }
 
+        // Slow path: a boxed variable (e.g. an `any` narrowed to a number).
+        // The C code needs to pass the ADDRESS of the variable to the runtime helper.
+        std::string helper;
         if (expr.op.type == TokenType::PLUS_PLUS) {
-            if (expr.isPrefix) {
-                // ++i  ->  angara_pre_increment(&i)
-                return "angara_pre_increment(&" + target_str + ")";
-            } else {
-                // i++  ->  angara_post_increment(&i)
-                return "angara_post_increment(&" + target_str + ")";
-            }
+            // ++i  ->  angara_pre_increment(&i),  i++  ->  angara_post_increment(&i)
+            helper = expr.isPrefix ? "angara_pre_increment" : "angara_post_increment";
         } else { // MINUS_MINUS
-            if (expr.isPrefix) {
-                // --i  ->  angara_pre_decrement(&i)
-                return "angara_pre_decrement(&" + target_str + ")";
-            } else {
-                // i--  ->  angara_post_decrement(&i)
-                return "angara_post_decrement(&" + target_str + ")";
-            }
+            // --i  ->  angara_pre_decrement(&i),  i--  ->  angara_post_decrement(&i)
+            helper = expr.isPrefix ? "angara_pre_decrement" : "angara_post_decrement";
         }
+        return unboxOwned(helper + "(&" + target_str + ")", result_type);
     }
 
-}
\ No newline at end of file
+}
@@ -17,14 +17,26 @@ namespace angara {
             return "/* unresolved var: " + expr.name.lexeme + " */";
         }
 
+        // The C variable is stored in its *declared* representation. If the type checker
+        // narrowed it (e.g. inside an `is` check), convert to the narrowed type on read.
         auto symbol = symbol_resolution->second;
+        auto expr_type = m_type_checker.m_expression_types.at(&expr);
+        return convertValue(transpileVarName(expr), symbol->type, expr_type);
+    }
+
+    std::string CTranspiler::transpileVarName(const VarExpr& expr) {
+        auto symbol = m_type_checker.m_variable_resolutions.at(&expr);
         if (symbol->depth > 0) {
             // It's a local variable or a parameter.
-            return sanitize_name(symbol->name);
+            return localName(*symbol);
         } else {
             // It's a global variable in the CURRENT module. Mangle it.
             // The closure for a function `parse` is `g_parse`. A global var `x` is `main_x`.
             if (symbol->type->kind == TypeKind::FUNCTION) {
+                // Reading a function as a value needs its closure to exist.
+                if (!symbol->from_module && m_global_functions.count(symbol->name)) {
+                    m_function_values.insert(symbol->name);
+                }
                 return "g_" + sanitize_name(symbol->name);
             }
             return m_current_module_name + "_" + sanitize_name(symbol->name);
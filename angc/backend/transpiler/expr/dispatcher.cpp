@@ -47,6 +47,8 @@ namespace angara{
                 return transpileSizeofExpr(*sizeof_expr);
             } else if (auto retype_expr = std::dynamic_pointer_cast<const RetypeExpr>(expr)) {
                 return transpileRetypeExpr(*retype_expr);
+            } else if (auto interpolated = std::dynamic_pointer_cast<const InterpolatedExpr>(expr)) {
+                return transpileInterpolatedExpr(*interpolated);
             }
             return "/* unknown expr */";
         }
@@ -5,6 +5,69 @@
 #include "CTranspiler.h"
 namespace angara {
 
+    void CTranspiler::transpileClassDrop(const ClassStmt& stmt) {
+        // The runtime calls this through the class before freeing an instance. It releases
+        // the boxed fields declared in this class, then hands the instance to the parent's
+        // drop, whose struct sits at the start of this one.
+        auto class_type = std::dynamic_pointer_cast<ClassType>(m_type_checker.m_symbols.resolve(stmt.name.lexeme)->type);
+        std::string c_struct_name = "Angara_" + class_type->name;
+
+        std::vector<std::string> boxed_fields;
+        for (const auto& member : stmt.members) {
+            if (auto field_member = std::dynamic_pointer_cast<const FieldMember>(member)) {
+                const auto& field_name = field_member->declaration->name.lexeme;
+                if (!isUnboxed(class_type->fields.at(field_name).type)) boxed_fields.push_back(field_name);
+            }
+        }
+
+        (*m_current_out) << "void Angara_drop_" << class_type->name << "(Object* object) {\n";
+        m_indent_level++;
+        if (!boxed_fields.empty()) {
+            indent();
+            (*m_current_out) << c_struct_name << "* self = (" << c_struct_name << "*)object;\n";
+            for (const auto& field_name : boxed_fields) {
+                indent();
+                (*m_current_out) << "angara_decref(self->" << field_name << ");\n";
+            }
+        }
+        if (class_type->superclass) {
+            indent();
+            (*m_current_out) << "Angara_drop_" << class_type->superclass->name << "(object);\n";
+        }
+        m_indent_level--;
+        (*m_current_out) << "}\n\n";
+    }
+
+    void CTranspiler::transpileClassTraverse(const ClassStmt& stmt) {
+        // The cycle collector walks an instance through its class: this visits the same
+        // fields the drop releases, then the parent's.
+        auto class_type = std::dynamic_pointer_cast<ClassType>(m_type_checker.m_symbols.resolve(stmt.name.lexeme)->type);
+        std::string c_struct_name = "Angara_" + class_type->name;
+
+        (*m_current_out) << "void Angara_traverse_" << class_type->name << "(Object* object, AngaraVisitFn visit, void* context) {\n";
+        m_indent_level++;
+        bool has_boxed_field = false;
+        for (const auto& member : stmt.members) {
+            auto field_member = std::dynamic_pointer_cast<const FieldMember>(member);
+            if (!field_member) continue;
+            const auto& field_name = field_member->declaration->name.lexeme;
+            if (isUnboxed(class_type->fields.at(field_name).type)) continue;
+            if (!has_boxed_field) {
+                indent();
+                (*m_current_out) << c_struct_name << "* self = (" << c_struct_name << "*)object;\n";
+                has_boxed_field = true;
+            }
+            indent();
+            (*m_current_out) << "visit(&self->" << field_name << ", context);\n";
+        }
+        if (class_type->superclass) {
+            indent();
+            (*m_current_out) << "Angara_traverse_" << class_type->superclass->name << "(object, visit, context);\n";
+        }
+        m_indent_level--;
+        (*m_current_out) << "}\n\n";
+    }
+
     void CTranspiler::transpileClassNew(const ClassStmt& stmt) {
         // This helper generates the implementation for the public `_new` constructor function.
         // This function is responsible for allocating memory and calling the user-defined `init`.
@@ -39,7 +102,7 @@ namespace angara {
 
         //    Step 2b: Box the raw C pointer into a generic AngaraObject.
         indent();
-        (*m_current_out) << "AngaraObject this_obj = (AngaraObject){VAL_OBJ, {.obj = (Object*)instance}};\n";
+        (*m_current_out) << "AngaraObject this_obj = ANGARA_OBJ_VAL(instance);\n";
 
         //    Step 2c: Conditionally call the user-defined `_init` method.
         if (init_method_ast) {
@@ -36,8 +36,11 @@ namespace angara {
                     std::string ptr_b = "((" + nested_struct_name + "*)AS_OBJ(b->" + field_name + "))";
 
                     (*m_current_out) << "Angara_" << field_type->toString() << "_equals(" << ptr_a << ", " << ptr_b << ")";
+                } else if (isUnboxed(field_type)) {
+                    // Case 2: The field is a raw C number or bool.
+                    (*m_current_out) << "(a->" << field_name << " == b->" << field_name << ")";
                 } else {
-                    // Case 2: The field is any other type (primitive wrapped in AngaraObject).
+                    // Case 3: The field is any other type (wrapped in AngaraObject).
                     (*m_current_out) << "AS_BOOL(angara_equals(a->" << field_name << ", b->" << field_name << "))";
                 }
 
@@ -69,6 +72,53 @@ namespace angara {
         return ss.str();
     }
 
+    void CTranspiler::transpileDataDrop(const DataStmt& stmt) {
+        // Releases the boxed fields the data object owns; the runtime frees the memory after.
+        auto data_type = std::dynamic_pointer_cast<DataType>(m_type_checker.m_symbols.resolve(stmt.name.lexeme)->type);
+        std::string c_struct_name = "Angara_" + data_type->name;
+
+        (*m_current_out) << "static void Angara_drop_" << data_type->name << "(Object* object) {\n";
+        m_indent_level++;
+        bool has_boxed_field = false;
+        for (const auto& field_decl : stmt.fields) {
+            if (isUnboxed(data_type->fields.at(field_decl->name.lexeme).type)) continue;
+            if (!has_boxed_field) {
+                indent();
+                (*m_current_out) << c_struct_name << "* data = (" << c_struct_name << "*)object;\n";
+                has_boxed_field = true;
+            }
+            indent();
+            (*m_current_out) << "angara_decref(data->" << sanitize_name(field_decl->name.lexeme) << ");\n";
+        }
+        m_indent_level--;
+        (*m_current_out) << "}\n\n";
+    }
+
+    void CTranspiler::transpileDataTraverse(const DataStmt& stmt) {
+        // Visits the same fields for the cycle collector, and bundles both functions
+        // into the table every instance points to.
+        auto data_type = std::dynamic_pointer_cast<DataType>(m_type_checker.m_symbols.resolve(stmt.name.lexeme)->type);
+        std::string c_struct_name = "Angara_" + data_type->name;
+
+        (*m_current_out) << "static void Angara_traverse_" << data_type->name << "(Object* object, AngaraVisitFn visit, void* context) {\n";
+        m_indent_level++;
+        bool has_boxed_field = false;
+        for (const auto& field_decl : stmt.fields) {
+            if (isUnboxed(data_type->fields.at(field_decl->name.lexeme).type)) continue;
+            if (!has_boxed_field) {
+                indent();
+                (*m_current_out) << c_struct_name << "* data = (" << c_struct_name << "*)object;\n";
+                has_boxed_field = true;
+            }
+            indent();
+            (*m_current_out) << "visit(&data->" << sanitize_name(field_decl->name.lexeme) << ", context);\n";
+        }
+        m_indent_level--;
+        (*m_current_out) << "}\n\n";
+        (*m_current_out) << "static const AngaraTypeOps Angara_ops_" << data_type->name << " = {Angara_drop_"
+                         << data_type->name << ", Angara_traverse_" << data_type->name << "};\n\n";
+    }
+
     void CTranspiler::transpileDataConstructor(const DataStmt& stmt) {
         auto data_type = std::dynamic_pointer_cast<DataType>(m_type_checker.m_symbols.resolve(stmt.name.lexeme)->type);
         std::string c_struct_name = "Angara_" + data_type->name;
@@ -90,37 +140,23 @@ namespace angara {
 
         // --- 2. Generate the function body ---
 
-        // 2a. Malloc memory for the struct.
-        indent();
-        (*m_current_out) << c_struct_name << "* data = (" << c_struct_name << "*)malloc(sizeof(" << c_struct_name << "));\n";
-
-        // --- Add a check for malloc failure ---
-        indent();
-        (*m_current_out) << "if (data == NULL) {\n";
-        m_indent_level++;
-        indent();
-        // Throw a standard error message. This call does not return.
-        (*m_current_out) << "angara_throw_error(\"Out of memory: failed to allocate data instance for '" << data_type->name << "'.\");\n";
-        m_indent_level--;
-        indent();
-        (*m_current_out) << "}\n";
-
-        // 2b. Initialize the Angara Object header.
+        // 2a. Allocate the struct from the runtime's object allocator, which also
+        //     initializes the Angara Object header.
         indent();
-        (*m_current_out) << "data->obj.type = OBJ_DATA_INSTANCE;\n";
+        (*m_current_out) << c_struct_name << "* data = (" << c_struct_name << "*)angara_object_alloc(sizeof(" << c_struct_name << "), OBJ_DATA_INSTANCE);\n";
         indent();
-        (*m_current_out) << "data->obj.ref_count = 1;\n";
+        (*m_current_out) << "data->base.ops = &Angara_ops_" << data_type->name << ";\n";
 
-        // 2c. Assign each parameter to its corresponding struct field.
+        // 2b. Assign each parameter to its corresponding struct field.
         for (const auto& field_decl : fields) {
             std::string field_name = sanitize_name(field_decl->name.lexeme);
             indent();
             (*m_current_out) << "data->" << field_name << " = " << field_name << ";\n";
         }
 
-        // 2d. "Box" the raw C pointer into a generic AngaraObject and return it.
+        // 2c. "Box" the raw C pointer into a generic AngaraObject and return it.
         indent();
-        (*m_current_out) << "return (AngaraObject){ VAL_OBJ, { .obj = (Object*)data } };\n";
+        (*m_current_out) << "return ANGARA_OBJ_VAL(data);\n";
 
         m_indent_level--;
         (*m_current_out) << "}\n\n";
@@ -135,7 +171,7 @@ namespace angara {
             // The real struct is defined in the included C header.
             (*m_current_out) << "typedef struct " << c_struct_name << " {\n";
             m_indent_level++;
-            indent(); (*m_current_out) << "Object obj;\n";
+            indent(); (*m_current_out) << "AngaraDataInstance base;\n";
             // The payload is a single, opaque pointer to the real C struct.
             indent(); (*m_current_out) << "struct " << stmt.name.lexeme << "* ptr;\n";
             m_indent_level--;
@@ -148,8 +184,8 @@ namespace angara {
         (*m_current_out) << "struct " << c_struct_name << " {\n";
         m_indent_level++;
 
-        // The struct starts with the common Object header, just like a class instance.
-        indent(); (*m_current_out) << "Object obj;\n";
+        // The struct starts with the data instance header, which points to its type's functions.
+        indent(); (*m_current_out) << "AngaraDataInstance base;\n";
 
         // Define all the fields.
         // We iterate the AST `fields` to preserve the declaration order.
@@ -157,7 +193,7 @@ namespace angara {
             // We get the canonical, resolved type from the DataType.
             auto field_info = data_type->fields.at(field_decl->name.lexeme);
             indent();
-            // getCType will correctly return `AngaraObject` for all fields now.
+            // getCType returns a raw C type for numbers and bools, `AngaraObject` otherwise.
             (*m_current_out) << getCType(field_info.type) << " "
                              << sanitize_name(field_decl->name.lexeme) << ";\n";
         }
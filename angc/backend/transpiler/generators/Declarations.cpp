@@ -9,7 +9,8 @@ namespace angara {
         for (const auto& stmt : statements) {
             if (auto var_decl = std::dynamic_pointer_cast<const VarDeclStmt>(stmt)) {
                 if (var_decl->is_exported) {
-                    (*m_current_out) << "extern AngaraObject " << module_name << "_" << var_decl->name.lexeme << ";\n";
+                    auto var_type = m_type_checker.m_variable_types.at(var_decl.get());
+                    (*m_current_out) << "extern " << getCType(var_type) << " " << module_name << "_" << var_decl->name.lexeme << ";\n";
                 }
             }
         }
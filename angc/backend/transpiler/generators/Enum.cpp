@@ -12,14 +12,27 @@ namespace angara {
         for (const auto& variant_pair : enum_type->variants) {
             const auto& variant_name = variant_pair.first;
             const auto& variant_sig = variant_pair.second;
-            std::string c_func_name = "Angara_" + enum_name + "_" + variant_name;
+            const auto& param_types = variant_sig->param_types;
+
+            // A nullary variant carries nothing, so every use shares one immortal instance.
+            if (param_types.empty()) {
+                std::string value_name = enumSingletonName(enum_name, variant_name);
+                if (generate_prototype_only) {
+                    (*m_current_out) << "extern " << c_struct_name << " " << value_name << ";\n";
+                } else {
+                    (*m_current_out) << c_struct_name << " " << value_name << " = {{ANGARA_STATIC_HEADER(OBJ_ENUM_INSTANCE, ANGARA_OBJ_IMMORTAL), &Angara_ops_"
+                                     << enum_name << "}, " << c_struct_name << "_Tag_" << variant_name << "};\n\n";
+                }
+                continue;
+            }
 
             // --- Generate Signature ---
             // A constructor always returns a generic AngaraObject.
+            std::string c_func_name = "Angara_" + enum_name + "_" + variant_name;
             (*m_current_out) << "AngaraObject " << c_func_name << "(";
-            for (size_t i = 0; i < variant_sig->param_types.size(); ++i) {
-                (*m_current_out) << getCType(variant_sig->param_types[i]) << " arg" << i;
-                if (i < variant_sig->param_types.size() - 1) (*m_current_out) << ", ";
+            for (size_t i = 0; i < param_types.size(); ++i) {
+                (*m_current_out) << getCType(param_types[i]) << " arg" << i;
+                if (i < param_types.size() - 1) (*m_current_out) << ", ";
             }
             (*m_current_out) << ")";
 
@@ -32,31 +45,110 @@ namespace angara {
             (*m_current_out) << " {\n";
             m_indent_level++;
 
+            // The runtime allocator also initializes the object header.
             indent();
-            (*m_current_out) << c_struct_name << "* data = (" << c_struct_name << "*)malloc(sizeof(" << c_struct_name << "));\n";
+            (*m_current_out) << c_struct_name << "* data = (" << c_struct_name << "*)angara_object_alloc(sizeof(" << c_struct_name << "), OBJ_ENUM_INSTANCE);\n";
             indent();
-            (*m_current_out) << "if (data == NULL) { angara_throw_error(\"Out of memory creating enum instance.\"); }\n";
-
-            indent();
-            (*m_current_out) << "data->obj.type = OBJ_ENUM_INSTANCE; data->obj.ref_count = 1;\n";
+            (*m_current_out) << "data->base.ops = &Angara_ops_" << enum_name << ";\n";
             indent();
             (*m_current_out) << "data->tag = " << c_struct_name << "_Tag_" << variant_name << ";\n";
 
-            // Assign the payload, if one exists.
-            if (!variant_sig->param_types.empty()) {
+            // The constructor owns its arguments, so the payload keeps those references.
+            for (size_t i = 0; i < param_types.size(); ++i) {
                 indent();
-                // This simplified version assumes a single parameter.
-                (*m_current_out) << "data->payload." << sanitize_name(variant_name) << " = arg0;\n";
-                // A full implementation would need to handle incref-ing if the payload is an AngaraObject.
+                (*m_current_out) << "data->payload." << enumPayloadField(variant_name, i) << " = arg" << i << ";\n";
             }
 
             indent();
-            (*m_current_out) << "return (AngaraObject){ VAL_OBJ, { .obj = (Object*)data } };\n";
+            (*m_current_out) << "return ANGARA_OBJ_VAL(data);\n";
             m_indent_level--;
             (*m_current_out) << "}\n\n";
         }
     }
 
+    std::string CTranspiler::enumSingletonName(const std::string& enum_name, const std::string& variant_name) {
+        return "Angara_" + enum_name + "_" + variant_name + "_value";
+    }
+
+    std::string CTranspiler::enumPayloadField(const std::string& variant_name, size_t index) {
+        return sanitize_name(variant_name) + ".field" + std::to_string(index);
+    }
+
+    std::vector<std::pair<std::string, std::vector<std::string>>> CTranspiler::enumBoxedPayloads(const EnumType& enum_type) {
+        // For each variant with boxed payload fields, the fields that hold references.
+        std::vector<std::pair<std::string, std::vector<std::string>>> boxed_payloads;
+        for (const auto& [variant_name, variant_sig] : enum_type.variants) {
+            std::vector<std::string> fields;
+            for (size_t i = 0; i < variant_sig->param_types.size(); ++i) {
+                if (!isUnboxed(variant_sig->param_types[i])) fields.push_back(enumPayloadField(variant_name, i));
+            }
+            if (!fields.empty()) boxed_payloads.emplace_back(variant_name, std::move(fields));
+        }
+        return boxed_payloads;
+    }
+
+    void CTranspiler::transpileEnumDrop(const EnumStmt& stmt) {
+        // Releases the boxed payload fields of the variant the instance holds.
+        auto enum_type = std::dynamic_pointer_cast<EnumType>(m_type_checker.m_symbols.resolve(stmt.name.lexeme)->type);
+        std::string c_struct_name = "Angara_" + enum_type->name;
+
+        (*m_current_out) << "static void Angara_drop_" << enum_type->name << "(Object* object) {\n";
+        m_indent_level++;
+        auto boxed_payloads = enumBoxedPayloads(*enum_type);
+        if (!boxed_payloads.empty()) {
+            indent();
+            (*m_current_out) << c_struct_name << "* data = (" << c_struct_name << "*)object;\n";
+            indent();
+            (*m_current_out) << "switch (data->tag) {\n";
+            m_indent_level++;
+            for (const auto& [variant_name, fields] : boxed_payloads) {
+                indent();
+                (*m_current_out) << "case " << c_struct_name << "_Tag_" << variant_name << ":";
+                for (const auto& field : fields) (*m_current_out) << " angara_decref(data->payload." << field << ");";
+                (*m_current_out) << " break;\n";
+            }
+            indent();
+            (*m_current_out) << "default: break;\n";
+            m_indent_level--;
+            indent();
+            (*m_current_out) << "}\n";
+        }
+        m_indent_level--;
+        (*m_current_out) << "}\n\n";
+    }
+
+    void CTranspiler::transpileEnumTraverse(const EnumStmt& stmt) {
+        // Visits the same payload fields for the cycle collector, and bundles the enum's functions.
+        auto enum_type = std::dynamic_pointer_cast<EnumType>(m_type_checker.m_symbols.resolve(stmt.name.lexeme)->type);
+        std::string c_struct_name = "Angara_" + enum_type->name;
+
+        (*m_current_out) << "static void Angara_traverse_" << enum_type->name << "(Object* object, AngaraVisitFn visit, void* context) {\n";
+        m_indent_level++;
+        auto boxed_payloads = enumBoxedPayloads(*enum_type);
+        if (!boxed_payloads.empty()) {
+            indent();
+            (*m_current_out) << c_struct_name << "* data = (" << c_struct_name << "*)object;\n";
+            indent();
+            (*m_current_out) << "switch (data->tag) {\n";
+            m_indent_level++;
+            for (const auto& [variant_name, fields] : boxed_payloads) {
+                indent();
+                (*m_current_out) << "case " << c_struct_name << "_Tag_" << variant_name << ":";
+                for (const auto& field : fields) (*m_current_out) << " visit(&data->payload." << field << ", context);";
+                (*m_current_out) << " break;\n";
+            }
+            indent();
+            (*m_current_out) << "default: break;\n";
+            m_indent_level--;
+            indent();
+            (*m_current_out) << "}\n";
+        }
+        m_indent_level--;
+        (*m_current_out) << "}\n\n";
+        (*m_current_out) << "static const AngaraTypeOps Angara_ops_" << enum_type->name << " = {Angara_drop_"
+                         << enum_type->name << ", Angara_traverse_" << enum_type->name << "};\n\n";
+    }
+
     void CTranspiler::transpileEnumStructs(const EnumStmt& stmt) {
         std::string enum_name = stmt.name.lexeme;
         std::string c_base_name = "Angara_" + enum_name;
@@ -72,17 +164,19 @@ namespace angara {
         m_indent_level--;
         (*m_current_out) << "} " << c_base_name << "_Tag;\n\n";
 
-        // 2. Generate the payload union. Only include variants that have data.
+        // 2. Generate the payload union: one struct per variant that carries data, with
+        //    numbers and booleans stored unboxed. Nullary variants take no space.
         (*m_current_out) << "typedef union {\n";
         m_indent_level++;
         for (const auto& variant_pair : enum_type->variants) {
-            if (!variant_pair.second->param_types.empty()) {
-                // This simplified version assumes a variant has at most one parameter.
-                // A full implementation would use a nested struct for multi-param variants.
-                auto param_type = variant_pair.second->param_types[0];
-                indent();
-                (*m_current_out) << getCType(param_type) << " " << sanitize_name(variant_pair.first) << ";\n";
+            const auto& param_types = variant_pair.second->param_types;
+            if (param_types.empty()) continue;
+            indent();
+            (*m_current_out) << "struct {";
+            for (size_t i = 0; i < param_types.size(); ++i) {
+                (*m_current_out) << " " << getCType(param_types[i]) << " field" << i << ";";
             }
+            (*m_current_out) << " } " << sanitize_name(variant_pair.first) << ";\n";
         }
         m_indent_level--;
         (*m_current_out) << "} " << c_base_name << "_Payload;\n\n";
@@ -90,7 +184,7 @@ namespace angara {
         // 3. Generate the main struct for an enum instance
         (*m_current_out) << "typedef struct " << c_base_name << " {\n";
         m_indent_level++;
-        indent(); (*m_current_out) << "Object obj;\n";
+        indent(); (*m_current_out) << "AngaraDataInstance base;\n";
         indent(); (*m_current_out) << c_base_name << "_Tag tag;\n";
         indent(); (*m_current_out) << c_base_name << "_Payload payload;\n";
         m_indent_level--;
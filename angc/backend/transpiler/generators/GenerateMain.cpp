@@ -21,6 +21,10 @@ namespace angara {
             indent();
             (*m_current_out) << "Angara_" << mod_name << "_init_globals();\n";
         }
+        // With exception returns, a throw that nothing caught is still pending here.
+        if (m_exception_returns) {
+            indent(); (*m_current_out) << "angara_exit_if_uncaught();\n";
+        }
         (*m_current_out) << "\n";
 
         // indent(); *m_current_out << "Angara_" << module_name << "_init_globals();\n\n";
@@ -41,6 +45,9 @@ namespace angara {
             *m_current_out << "    angara_decref(args_list);\n";
         }
 
+        if (m_exception_returns) {
+            indent(); *m_current_out << "angara_exit_if_uncaught();\n";
+        }
         *m_current_out << "\n";
         indent(); *m_current_out << "int exit_code = (int)AS_I64(result);\n";
         indent(); *m_current_out << "angara_decref(result);\n\n";
@@ -27,6 +27,15 @@ namespace angara {
         transpileFunctionSignature(stmt, module_name);
         (*m_current_out) << " {\n";
         m_indent_level = 1;
+        m_current_return_type = func_type->return_type;
+
+        // The function's outermost drop scope holds its parameters; it drops the ones it owns.
+        m_scopes.clear();
+        enterScope();
+        for (size_t i = 0; i < stmt.params.size(); ++i) {
+            bool owned = isOwnedParam(func_type, i) && !isUnboxed(func_type->param_types[i]);
+            declareLocal(sanitize_name(stmt.params[i].name.lexeme), owned);
+        }
 
         // Transpile the function's body.
         if (stmt.body) {
@@ -37,11 +46,13 @@ namespace angara {
 
         // Handle implicit returns for functions that should return void.
         if (func_type->return_type->toString() == "nil") {
-            if (stmt.body->empty() || !isa<ReturnStmt>(stmt.body->back())) {
+            if (stmt.body->empty() || !isTerminator(stmt.body->back())) {
+                 emitDrops(0);
                  indent();
                  (*m_current_out) << "return angara_create_nil();\n";
             }
         }
+        m_scopes.clear();
         m_indent_level = 0;
         (*m_current_out) << "}\n\n";
 
@@ -55,21 +66,27 @@ namespace angara {
         m_indent_level = 1;
         indent();
 
+        // The wrapper is the boundary to the dynamic world: unbox typed arguments
+        // on the way in and box a typed result on the way out.
+        std::vector<std::string> wrapper_args;
+        // The caller keeps its references to `args`, so owned parameters get a new one.
+        for (int i = 0; i < stmt.params.size(); ++i) {
+            std::string arg = "args[" + std::to_string(i) + "]";
+            if (isOwnedParam(func_type, i) && !isUnboxed(func_type->param_types[i])) {
+                wrapper_args.push_back("angara_retain(" + arg + ")");
+            } else {
+                wrapper_args.push_back(unboxValue(arg, func_type->param_types[i]));
+            }
+        }
+        std::string call_str = mangled_impl_name + "(" + join_strings(wrapper_args, ", ") + ")";
+
         // Generate the call inside the wrapper, handling void vs. non-void returns.
         if (func_type->return_type->toString() == "nil") {
-            (*m_current_out) << mangled_impl_name << "(";
-            for (int i = 0; i < stmt.params.size(); ++i) {
-                (*m_current_out) << "args[" << i << "]" << (i == stmt.params.size() - 1 ? "" : ", ");
-            }
-            (*m_current_out) << ");\n";
+            (*m_current_out) << call_str << ";\n";
             indent();
             (*m_current_out) << "return angara_create_nil();\n";
         } else {
-            (*m_current_out) << "return " << mangled_impl_name << "(";
-            for (int i = 0; i < stmt.params.size(); ++i) {
-                (*m_current_out) << "args[" << i << "]" << (i == stmt.params.size() - 1 ? "" : ", ");
-            }
-            (*m_current_out) << ");\n";
+            (*m_current_out) << "return " << boxValue(call_str, func_type->return_type) << ";\n";
         }
         m_indent_level = 0;
         (*m_current_out) << "}\n\n";
@@ -15,7 +15,8 @@ namespace angara {
             if (auto class_stmt = std::dynamic_pointer_cast<const ClassStmt>(stmt)) {
                 (*m_current_out) << "AngaraClass g_" << class_stmt->name.lexeme << "_class;\n";
             } else if (auto var_decl = std::dynamic_pointer_cast<const VarDeclStmt>(stmt)) {
-                (*m_current_out) << "AngaraObject " << module_name << "_" << var_decl->name.lexeme << ";\n";
+                auto var_type = m_type_checker.m_variable_types.at(var_decl.get());
+                (*m_current_out) << getCType(var_type) << " " << module_name << "_" << var_decl->name.lexeme << ";\n";
             } else if (auto func_stmt = std::dynamic_pointer_cast<const FuncStmt>(stmt)) {
                 std::string var_name = "g_" + func_stmt->name.lexeme;
                 if (func_stmt->name.lexeme == "main") var_name = "g_angara_main_closure";
@@ -69,58 +70,91 @@ namespace angara {
         }
         (*m_current_out) << "\n";
 
-        // === Stage C: Global Initializer Function ===
-        std::string init_func_name = "Angara_" + module_name + "_init_globals";
-        (*m_current_out) << "void " << init_func_name << "(void) {\n";
+        // === Stage C: Function and Method Implementations ===
+        // These are generated into a buffer ahead of the initializer below, so that it
+        // knows which functions are read as values and need a closure.
+        std::stringstream implementations;
+        std::stringstream* out = m_current_out;
+        m_current_out = &implementations;
+        for (const auto& stmt : statements) {
+            if (auto func_stmt = std::dynamic_pointer_cast<const FuncStmt>(stmt)) {
+                if (!func_stmt->is_foreign) {
+                    transpileGlobalFunction(*func_stmt, module_name);
+                }
+            } else if (auto class_stmt = std::dynamic_pointer_cast<const ClassStmt>(stmt)) {
+                m_current_class_name = class_stmt->name.lexeme;
+                auto class_type = std::dynamic_pointer_cast<ClassType>(m_type_checker.m_symbols.resolve(class_stmt->name.lexeme)->type);
+                transpileClassDrop(*class_stmt);
+                transpileClassTraverse(*class_stmt);
+                transpileClassNew(*class_stmt);
+                for (const auto& member : class_stmt->members) {
+                    if (auto method_member = std::dynamic_pointer_cast<const MethodMember>(member)) {
+                        transpileMethodBody(*class_type, *method_member->declaration);
+                    }
+                }
+                m_current_class_name = "";
+            }
+        }
+
+        // === Stage D: Global Initializer Function ===
+        // Global initializers may read functions as values too, so they are buffered as well.
+        std::stringstream initializers;
+        m_current_out = &initializers;
         m_indent_level = 1;
         for (const auto& stmt : statements) {
             if (auto var_decl = std::dynamic_pointer_cast<const VarDeclStmt>(stmt)) {
                 indent();
                 (*m_current_out) << module_name << "_" << var_decl->name.lexeme << " = ";
+                auto var_type = m_type_checker.m_variable_types.at(var_decl.get());
                 if (var_decl->initializer) {
-                    // If an initializer exists, transpile it.
-                    (*m_current_out) << transpileExpr(var_decl->initializer) << ";";
+                    // If an initializer exists, transpile it in the global's C representation.
+                    // Every thread can reach a global, so a boxed value is shared from the start.
+                    std::string init_str = transpileOwned(var_decl->initializer, var_type);
+                    if (!isUnboxed(var_type)) init_str = "angara_share(" + init_str + ")";
+                    (*m_current_out) << init_str << ";\n";
                 } else {
-                    // If no initializer, the default value is `nil`.
-                    (*m_current_out) << "angara_create_nil();";
+                    // If no initializer, the default value is `nil` (or zero for raw numbers).
+                    (*m_current_out) << defaultValue(var_type) << ";\n";
                 }
-            } else if (auto func_stmt = std::dynamic_pointer_cast<const FuncStmt>(stmt)) {
-                if (func_stmt->is_foreign) {
-                    continue;
-                }
-                std::string var_name = "g_" + func_stmt->name.lexeme;
-                if (func_stmt->name.lexeme == "main") var_name = "g_angara_main_closure";
-                std::string mangled_name = "angara_f_" + module_name + "_" + func_stmt->name.lexeme;
-                if (func_stmt->name.lexeme == "main") mangled_name = "angara_f_main";
-                indent();
-                (*m_current_out) << var_name << " = angara_closure_new(&angara_w_" << mangled_name << ", " << func_stmt->params.size() << ", false);\n";
             } else if (auto class_stmt = std::dynamic_pointer_cast<const ClassStmt>(stmt)) {
                 indent();
-                (*m_current_out) << "g_" << class_stmt->name.lexeme << "_class = (AngaraClass){{OBJ_CLASS, 1}, \"" << class_stmt->name.lexeme << "\"};\n";
+                (*m_current_out) << "g_" << class_stmt->name.lexeme << "_class = (AngaraClass){ANGARA_STATIC_HEADER(OBJ_CLASS, ANGARA_OBJ_SHARED), \""
+                                 << class_stmt->name.lexeme << "\", Angara_drop_" << class_stmt->name.lexeme
+                                 << ", Angara_traverse_" << class_stmt->name.lexeme << "};\n";
             }
         }
-        m_indent_level = 0;
-        (*m_current_out) << "}\n\n";
+        m_current_out = out;
 
-        // === Stage D: Function and Method Implementations ===
-        (*m_current_out) << "// --- Function Implementations ---\n";
+        std::string init_func_name = "Angara_" + module_name + "_init_globals";
+        (*m_current_out) << "void " << init_func_name << "(void) {\n";
+        indent();
+        (*m_current_out) << "Angara_" << module_name << "_intern_literals();\n";
         for (const auto& stmt : statements) {
             if (auto func_stmt = std::dynamic_pointer_cast<const FuncStmt>(stmt)) {
-                if (!func_stmt->is_foreign) {
-                    transpileGlobalFunction(*func_stmt, module_name);
+                if (func_stmt->is_foreign) {
+                    continue;
                 }
-            } else if (auto class_stmt = std::dynamic_pointer_cast<const ClassStmt>(stmt)) {
-                m_current_class_name = class_stmt->name.lexeme;
-                auto class_type = std::dynamic_pointer_cast<ClassType>(m_type_checker.m_symbols.resolve(class_stmt->name.lexeme)->type);
-                transpileClassNew(*class_stmt);
-                for (const auto& member : class_stmt->members) {
-                    if (auto method_member = std::dynamic_pointer_cast<const MethodMember>(member)) {
-                        transpileMethodBody(*class_type, *method_member->declaration);
-                    }
+                // Other modules may read an exported function as a value, and main is
+                // started through its closure; any other function only needs one if it
+                // is read as a value in this module.
+                const std::string& name = func_stmt->name.lexeme;
+                if (!func_stmt->is_exported && name != "main" && !m_function_values.count(name)) {
+                    continue;
                 }
-                m_current_class_name = "";
+                std::string var_name = "g_" + name;
+                if (name == "main") var_name = "g_angara_main_closure";
+                std::string mangled_name = "angara_f_" + module_name + "_" + name;
+                if (name == "main") mangled_name = "angara_f_main";
+                indent();
+                (*m_current_out) << var_name << " = angara_share(angara_closure_new(&angara_w_" << mangled_name << ", " << func_stmt->params.size() << ", false));\n";
             }
         }
+        (*m_current_out) << initializers.str();
+        m_indent_level = 0;
+        (*m_current_out) << "}\n\n";
+
+        (*m_current_out) << "// --- Function Implementations ---\n";
+        (*m_current_out) << implementations.str();
     }
 
 }
\ No newline at end of file
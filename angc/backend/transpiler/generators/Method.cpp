@@ -37,6 +37,7 @@ namespace angara {
     void CTranspiler::transpileMethodBody(const ClassType& klass, const FuncStmt& stmt) {
         // 1. Generate the full function signature again (this time for the definition).
         transpileMethodSignature(klass.name, stmt);
+        m_current_return_type = std::dynamic_pointer_cast<FunctionType>(klass.methods.at(stmt.name.lexeme).type)->return_type;
         (*m_current_out) << " {\n";
         m_indent_level++;
 
@@ -46,7 +47,16 @@ namespace angara {
             (*m_current_out) << "struct Angara_" << klass.name << "* this = (struct Angara_" << klass.name << "*)AS_INSTANCE(this_obj);\n";
         }
 
-        // 3. Transpile all statements in the method's body.
+        // 3. Transpile all statements in the method's body. `this` is always borrowed;
+        //    the parameters open its outermost drop scope, which drops the ones it owns.
+        auto method_info = klass.methods.at(stmt.name.lexeme);
+        auto func_type = std::dynamic_pointer_cast<FunctionType>(method_info.type);
+        m_scopes.clear();
+        enterScope();
+        for (size_t i = 0; i < stmt.params.size(); ++i) {
+            bool owned = isOwnedParam(func_type, i) && !isUnboxed(func_type->param_types[i]);
+            declareLocal(sanitize_name(stmt.params[i].name.lexeme), owned);
+        }
         if (stmt.body) {
             for (const auto& body_stmt : *stmt.body) {
                 transpileStmt(body_stmt);
@@ -54,12 +64,14 @@ namespace angara {
         }
 
         // 4. Handle implicit returns for void methods.
-        auto method_info = klass.methods.at(stmt.name.lexeme);
-        auto func_type = std::dynamic_pointer_cast<FunctionType>(method_info.type);
         if (func_type->return_type->toString() == "nil") {
+            if (!stmt.body || stmt.body->empty() || !isTerminator(stmt.body->back())) {
+                emitDrops(0);
+            }
             indent();
             (*m_current_out) << "return angara_create_nil();\n";
         }
+        m_scopes.clear();
 
         m_indent_level--;
         (*m_current_out) << "}\n\n";
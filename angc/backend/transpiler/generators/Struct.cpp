@@ -10,11 +10,13 @@ namespace angara {
             if (auto class_stmt = std::dynamic_pointer_cast<const ClassStmt>(stmt)) {
                 transpileStruct(*class_stmt);
                 (*m_current_out) << "extern AngaraClass g_" << class_stmt->name.lexeme << "_class;\n";
+                (*m_current_out) << "void Angara_drop_" << class_stmt->name.lexeme << "(Object* object);\n";
+                (*m_current_out) << "void Angara_traverse_" << class_stmt->name.lexeme
+                                 << "(Object* object, AngaraVisitFn visit, void* context);\n";
             }
-            // --- THIS IS THE FIX ---
-            // Also look for DataStmt and Foreign DataStmt and generate their structs.
+            // Foreign data wrappers; ordinary data structs were already emitted ahead of the enums.
             else if (auto data_stmt = std::dynamic_pointer_cast<const DataStmt>(stmt)) {
-                transpileDataStruct(*data_stmt);
+                if (data_stmt->is_foreign) transpileDataStruct(*data_stmt);
             }
         }
     }
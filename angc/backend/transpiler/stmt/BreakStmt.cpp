@@ -5,6 +5,7 @@
 namespace angara {
 
     void CTranspiler::transpileBreakStmt(const BreakStmt& stmt) {
+        emitDrops(innermostLoopScope());
         indent();
         (*m_current_out) << "break;\n";
     }
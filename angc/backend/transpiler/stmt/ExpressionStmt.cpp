@@ -6,6 +6,11 @@ namespace angara {
 
     void CTranspiler::transpileExpressionStmt(const ExpressionStmt& stmt) {
         indent();
+        // A discarded result that we own is dropped on the spot.
+        if (yieldsOwnedObject(stmt.expression)) {
+            (*m_current_out) << "angara_decref(" << transpileBoxed(stmt.expression) << ");\n";
+            return;
+        }
         (*m_current_out) << transpileExpr(stmt.expression) << ";\n";
     }
 
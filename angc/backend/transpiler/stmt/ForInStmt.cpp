@@ -5,59 +5,130 @@
 namespace angara {
 
     void CTranspiler::transpileForInStmt(const ForInStmt& stmt) {
+        const std::string var_name = localName(stmt.name);
+        const std::string index_name = "__index_" + var_name;
+        auto collection_type = m_type_checker.m_expression_types.at(stmt.collection.get());
+
         indent(); (*m_current_out) << "{\n"; // Start a new scope
         m_indent_level++;
+        enterScope();
 
-        // 1. Create and initialize the hidden __collection variable.
-        indent();
-        (*m_current_out) << "AngaraObject __collection_" << sanitize_name(stmt.name.lexeme)  << " = "
-                         << transpileExpr(stmt.collection) << ";\n";
-        indent();
-        (*m_current_out) << "angara_incref(__collection_" << sanitize_name(stmt.name.lexeme)  << ");\n";
+        // 1. Generate the counted loop header and the `let item = ...` declaration.
+        std::shared_ptr<Type> item_type;
+        bool item_owned = false;
+        if (auto range_call = rangeCall(stmt.collection)) {
+            // `for i in range(a, b[, step])` counts in a C integer; no list is ever built.
+            // The bounds are evaluated once, in source order, and the last step stops
+            // at the end instead of overflowing past it.
+            const auto& args = range_call->arguments;
+            std::string start_name = "__start_" + var_name;
+            std::string end_name = "__end_" + var_name;
+            std::string step_name = "__step_" + var_name;
+            item_type = m_i64_type;
+            indent();
+            (*m_current_out) << "const int64_t " << start_name << " = " << transpileExprAs(args[0], m_i64_type) << ";\n";
+            indent();
+            (*m_current_out) << "const int64_t " << end_name << " = " << transpileExprAs(args[1], m_i64_type) << ";\n";
+            indent();
+            (*m_current_out) << "const int64_t " << step_name << " = "
+                             << (args.size() > 2 ? transpileExprAs(args[2], m_i64_type) : "INT64_C(1)") << ";\n";
+            indent();
+            (*m_current_out) << "for (int64_t " << index_name << " = " << start_name << "; "
+                             << step_name << " > 0 ? " << index_name << " < " << end_name << " : "
+                             << step_name << " < 0 && " << index_name << " > " << end_name << "; "
+                             << index_name << " = angara_range_advance(" << index_name << ", " << end_name << ", "
+                             << step_name << ")) {\n";
+            m_indent_level++;
+            indent();
+            (*m_current_out) << "int64_t " << var_name << " = " << index_name << ";\n";
+        } else {
+            // The hidden __collection variable keeps the collection alive for the whole loop.
+            std::string collection_name = "__collection_" + var_name;
+            indent();
+            (*m_current_out) << "AngaraObject " << collection_name << " = "
+                             << transpileOwned(stmt.collection, collection_type) << ";\n";
+            declareLocal(collection_name, true);
 
-        // 2. Create and initialize the hidden __index variable.
-        indent();
-        (*m_current_out) << "AngaraObject __index_" << sanitize_name(stmt.name.lexeme)  << " = angara_create_i64(0LL);\n";
+            if (collection_type->kind == TypeKind::LIST) {
+                // The length is read once. Adding or removing elements in the body bumps
+                // the list's modification stamp, which is checked before every element.
+                std::string list_name = "__list_" + var_name;
+                std::string length_name = "__length_" + var_name;
+                std::string stamp_name = "__stamp_" + var_name;
+                indent();
+                (*m_current_out) << "AngaraList* " << list_name << " = AS_LIST(" << collection_name << ");\n";
+                indent();
+                (*m_current_out) << "const size_t " << length_name << " = " << list_name << "->count;\n";
+                indent();
+                (*m_current_out) << "const uint64_t " << stamp_name << " = " << list_name << "->mod_stamp;\n";
+                indent();
+                (*m_current_out) << "for (size_t " << index_name << " = 0; " << index_name << " < " << length_name
+                                 << "; " << index_name << "++) {\n";
+                m_indent_level++;
+                // With exception returns the throw comes back, and the loop must not go on.
+                std::string modified = "angara_throw_error(\"List was modified while a for-in loop was iterating over it.\");";
+                if (m_exception_returns) modified = "{ " + modified + " " + propagateException() + " }";
+                indent();
+                (*m_current_out) << "if (ANGARA_UNLIKELY(" << list_name << "->mod_stamp != " << stamp_name
+                                 << ")) " << modified << "\n";
 
-        // 3. Generate the `while` loop header.
-        indent();
-        (*m_current_out) << "while (angara_is_truthy(angara_create_bool(AS_I64(__index_" << sanitize_name(stmt.name.lexeme)  << ") < AS_I64(angara_len(__collection_" << sanitize_name(stmt.name.lexeme)  << "))))) {\n";
-        m_indent_level++;
-
-        // 4. Generate the `let item = ...` declaration.
-        indent();
-        (*m_current_out) << "AngaraObject " << sanitize_name(stmt.name.lexeme)  << " = angara_list_get(__collection_"
-                         << sanitize_name(stmt.name.lexeme)  << ", __index_" << sanitize_name(stmt.name.lexeme)  << ");\n";
+                // When the body cannot release the list's items, the item is borrowed straight
+                // from the list's storage; otherwise it holds its own reference for the iteration.
+                item_type = std::dynamic_pointer_cast<ListType>(collection_type)->element_type;
+                item_owned = !isUnboxed(item_type) && !m_ownership.borrowsItems(stmt);
+                std::string packed = packedListElement(collection_type);
+                std::string element_str = list_name + "->elements[" + index_name + "]";
+                if (!packed.empty()) {
+                    element_str = "angara_list_" + packed + "_at(" + list_name + ", " + index_name + ")";
+                } else {
+                    if (item_owned) element_str = "angara_retain(" + element_str + ")";
+                    element_str = unboxValue(element_str, item_type);
+                }
+                indent();
+                (*m_current_out) << getCType(item_type) << " " << var_name << " = " << element_str << ";\n";
+            } else {
+                // A string yields its characters as one-byte strings, which are preallocated.
+                std::string string_name = "__string_" + var_name;
+                item_type = collection_type;
+                indent();
+                (*m_current_out) << "AngaraString* " << string_name << " = AS_STRING(" << collection_name << ");\n";
+                indent();
+                (*m_current_out) << "for (size_t " << index_name << " = 0; " << index_name << " < " << string_name
+                                 << "->length; " << index_name << "++) {\n";
+                m_indent_level++;
+                indent();
+                (*m_current_out) << "AngaraObject " << var_name << " = angara_create_string_with_len("
+                                 << string_name << "->chars + " << index_name << ", 1);\n";
+            }
+        }
 
-        // 5. Transpile the user's loop body.
+        // 2. Transpile the user's loop body.
+        enterScope(true);
+        declareLocal(var_name, item_owned);
         transpileStmt(stmt.body);
 
-        // 6. Generate the increment logic: `__index = __index + 1`.
-        indent();
-        (*m_current_out) << "{\n";
-        m_indent_level++;
-        indent(); (*m_current_out) << "AngaraObject __temp_one = angara_create_i64(1LL);\n";
-        indent(); (*m_current_out) << "AngaraObject __new_index = angara_create_i64(AS_I64(__index_" << sanitize_name(stmt.name.lexeme)  << ") + AS_I64(__temp_one));\n";
-        indent(); (*m_current_out) << "angara_decref(__index_" << sanitize_name(stmt.name.lexeme)  << ");\n";
-        indent(); (*m_current_out) << "__index_" << sanitize_name(stmt.name.lexeme)  << " = __new_index;\n";
-        m_indent_level--;
-        indent(); (*m_current_out) << "}\n";
-
-        // 7. Decref the user's loop variable at the end of the iteration.
-        indent(); (*m_current_out) << "angara_decref(" << sanitize_name(stmt.name.lexeme)  << ");\n";
+        // 3. Drop the user's loop variable at the end of the iteration, if it owns one.
+        exitScope(true);
 
         m_indent_level--;
         indent();
         (*m_current_out) << "}\n";
 
-        // 8. Decref the hidden variables at the end of the scope.
-        indent();
-        (*m_current_out) << "angara_decref(__collection_" << sanitize_name(stmt.name.lexeme) << ");\n";
-        indent();
-        (*m_current_out) << "angara_decref(__index_" << sanitize_name(stmt.name.lexeme)  << ");\n";
+        // 4. Drop the hidden collection at the end of the scope.
+        exitScope(true);
 
         m_indent_level--;
         indent(); (*m_current_out) << "}\n";
     }
 
-}
\ No newline at end of file
+    std::shared_ptr<const CallExpr> CTranspiler::rangeCall(const std::shared_ptr<Expr>& expr) {
+        auto call = std::dynamic_pointer_cast<const CallExpr>(expr);
+        if (!call) return nullptr;
+        auto var_expr = std::dynamic_pointer_cast<const VarExpr>(call->callee);
+        if (!var_expr || var_expr->name.lexeme != "range") return nullptr;
+        // Built-in functions are declared without a source position.
+        auto symbol = m_type_checker.m_variable_resolutions.at(var_expr.get());
+        return symbol && symbol->declaration_token.line == 0 ? call : nullptr;
+    }
+
+}
@@ -5,18 +5,30 @@
 namespace angara {
 
     void CTranspiler::transpileForStmt(const ForStmt& stmt) {
+        // A boxed loop variable owns its value, so the loop gets an enclosing C block
+        // where the variable is declared and dropped once the loop is done.
+        auto var_decl = std::dynamic_pointer_cast<const VarDeclStmt>(stmt.initializer);
+        bool owns_initializer = var_decl && !isUnboxed(m_type_checker.m_variable_types.at(var_decl.get()));
+        if (owns_initializer) {
+            indent(); (*m_current_out) << "{\n";
+            m_indent_level++;
+            enterScope();
+            transpileStmt(stmt.initializer);
+        }
+
         indent();
         // In C, the scope of a for-loop initializer is the loop itself.
         // So we don't need an extra `{}` block unless the body isn't one.
         (*m_current_out) << "for (";
 
         // --- 1. Initializer ---
-        if (stmt.initializer) {
+        if (stmt.initializer && !owns_initializer) {
             // The initializer is a full statement. We need to generate its code
             // but without the trailing semicolon and newline. We can achieve this
             // by temporarily redirecting the output stream.
             std::stringstream init_ss;
             std::stringstream* temp_out = m_current_out;
+            int saved_indent = m_indent_level;
             m_current_out = &init_ss;
             m_indent_level = 0; // No indent inside the for()
 
@@ -24,7 +36,7 @@ namespace angara {
 
             // Restore original stream and level
             m_current_out = temp_out;
-            m_indent_level = 1; // Assuming we are inside main
+            m_indent_level = saved_indent;
 
             std::string init_str = init_ss.str();
             // Trim whitespace, semicolon, and newline from the end
@@ -35,18 +47,28 @@ namespace angara {
 
         // --- 2. Condition ---
         if (stmt.condition) {
-            (*m_current_out) << "angara_is_truthy(" << transpileExpr(stmt.condition) << ")";
+            (*m_current_out) << transpileCondition(stmt.condition);
         }
         (*m_current_out) << "; ";
 
         // --- 3. Increment ---
         if (stmt.increment) {
-            (*m_current_out) << transpileExpr(stmt.increment);
+            std::string increment_str = transpileExpr(stmt.increment);
+            if (yieldsOwnedObject(stmt.increment)) increment_str = "angara_decref(" + increment_str + ")";
+            (*m_current_out) << increment_str;
         }
         (*m_current_out) << ") ";
 
         // --- 4. Body ---
+        enterScope(true);
         transpileStmt(stmt.body);
+        exitScope(false);
+
+        if (owns_initializer) {
+            exitScope(true);
+            m_indent_level--;
+            indent(); (*m_current_out) << "}\n";
+        }
     }
 
 }
\ No newline at end of file
@@ -11,22 +11,35 @@ namespace angara {
             indent(); (*m_current_out) << "{\n";
             m_indent_level++;
 
-            // 1. Evaluate the initializer into a temporary variable.
+            // 1. Evaluate the initializer into a temporary variable. If the initializer
+            //    produced a new reference, the temporary owns it and the binding borrows it.
+            std::string tmp_name = freshTemp("__tmp_if_let");
             indent();
-            (*m_current_out) << "AngaraObject __tmp_if_let = " << transpileExpr(stmt.declaration->initializer) << ";\n";
+            (*m_current_out) << "AngaraObject " << tmp_name << " = " << transpileBoxed(stmt.declaration->initializer) << ";\n";
+            enterScope();
+            declareLocal(tmp_name, yieldsOwnedObject(stmt.declaration->initializer));
 
             // 2. The condition is a simple nil check on the temporary.
             indent();
-            (*m_current_out) << "if (!IS_NIL(__tmp_if_let)) {\n";
+            (*m_current_out) << "if (!IS_NIL(" << tmp_name << ")) {\n";
             m_indent_level++;
+            enterScope();
+            std::string bound_name = localName(stmt.declaration->name);
+            declareLocal(bound_name, false);
 
-            // 3. If not nil, declare the new variable inside the `if` block.
+            // 3. If not nil, declare the new variable inside the `if` block,
+            //    unboxed to the unwrapped type when that is a number or bool.
+            auto init_type = m_type_checker.m_expression_types.at(stmt.declaration->initializer.get());
+            auto bound_type = (init_type->kind == TypeKind::OPTIONAL)
+                ? std::dynamic_pointer_cast<OptionalType>(init_type)->wrapped_type
+                : init_type;
             indent();
-            (*m_current_out) << "const AngaraObject " << sanitize_name(stmt.declaration->name.lexeme)
-                             << " = __tmp_if_let;\n";
+            (*m_current_out) << "const " << getCType(bound_type) << " " << bound_name
+                             << " = " << unboxValue(tmp_name, bound_type) << ";\n";
 
             // 4. Transpile the 'then' block.
             transpileStmt(stmt.thenBranch);
+            exitScope(false);
 
             m_indent_level--;
             indent(); (*m_current_out) << "}";
@@ -38,6 +51,7 @@ namespace angara {
             } else {
                 (*m_current_out) << "\n";
             }
+            exitScope(true);
 
             m_indent_level--;
             indent(); (*m_current_out) << "}\n";
@@ -46,7 +60,7 @@ namespace angara {
         }
 
         // --- Case 2: Handle regular `if` with a boolean condition ---
-        std::string condition_str = "angara_is_truthy(" + transpileExpr(stmt.condition) + ")";
+        std::string condition_str = transpileCondition(stmt.condition);
         indent();
         (*m_current_out) << "if (" << condition_str << ") ";
         transpileStmt(stmt.thenBranch);
@@ -5,12 +5,50 @@
 namespace angara {
 
     void CTranspiler::transpileReturnStmt(const ReturnStmt& stmt) {
-        indent();
-        (*m_current_out) << "return";
-        if (stmt.value) {
-            (*m_current_out) << " " << transpileExpr(stmt.value);
+        if (!stmt.value) {
+            emitDrops(0);
+            indent();
+            (*m_current_out) << "return;\n";
+            return;
+        }
+
+        // 1. Returning an owned local hands its reference straight to the caller.
+        if (auto var_expr = std::dynamic_pointer_cast<const VarExpr>(stmt.value)) {
+            auto symbol = m_type_checker.m_variable_resolutions.at(var_expr.get());
+            std::string name = localName(*symbol);
+            if (symbol->depth > 0 && !isUnboxed(symbol->type) && !isUnboxed(m_current_return_type) &&
+                isOwnedLocal(name)) {
+                emitDrops(0, name);
+                indent();
+                (*m_current_out) << "return " << transpileExprAs(stmt.value, m_current_return_type) << ";\n";
+                return;
+            }
+        }
+
+        // 2. Otherwise the result is computed before the locals it may borrow from are dropped,
+        //    and inside the `try` bodies being left, so a throw while computing it is still caught.
+        std::string value = transpileOwned(stmt.value, m_current_return_type);
+        bool has_drops = false;
+        for (const auto& scope : m_scopes) {
+            for (const auto& local : scope.locals) has_drops |= local.owned;
+            has_drops |= !scope.try_frame.empty();
         }
-        (*m_current_out) << ";\n";
+        if (!has_drops) {
+            indent();
+            (*m_current_out) << "return " << value << ";\n";
+            return;
+        }
+        indent();
+        (*m_current_out) << "{\n";
+        m_indent_level++;
+        indent();
+        (*m_current_out) << getCType(m_current_return_type) << " __ret = " << value << ";\n";
+        emitDrops(0);
+        indent();
+        (*m_current_out) << "return __ret;\n";
+        m_indent_level--;
+        indent();
+        (*m_current_out) << "}\n";
     }
 
 }
\ No newline at end of file
@@ -6,8 +6,14 @@
 namespace angara{
 
     void CTranspiler::transpileThrowStmt(const ThrowStmt& stmt) {
+        // The thrown value's reference passes to the runtime, and from there to the catch variable.
         indent();
-        (*m_current_out) << "angara_throw(" << transpileExpr(stmt.expression) << ");\n";
+        (*m_current_out) << "angara_throw(" << transpileOwned(stmt.expression, m_any_type) << ");\n";
+        // With exception returns, angara_throw comes back and the exception is carried on from here.
+        if (m_exception_returns) {
+            indent();
+            (*m_current_out) << propagateException() << "\n";
+        }
     }
 
 }
\ No newline at end of file
@@ -5,29 +5,75 @@
 namespace angara {
 
     void CTranspiler::transpileTryStmt(const TryStmt& stmt) {
+        if (m_exception_returns) {
+            transpileTryReturns(stmt);
+            return;
+        }
+
+        // Each frame gets its own name, so a `return` or `break` that leaves several
+        // nested `try` bodies can pop all of their frames.
+        std::string frame = freshTemp("__frame");
         indent(); (*m_current_out) << "{\n";
         m_indent_level++;
-        indent(); (*m_current_out) << "ExceptionFrame __frame;\n";
-        indent(); (*m_current_out) << "__frame.prev = g_exception_chain_head;\n";
-        indent(); (*m_current_out) << "g_exception_chain_head = &__frame;\n";
+        indent(); (*m_current_out) << "ExceptionFrame " << frame << ";\n";
+        indent(); (*m_current_out) << frame << ".prev = g_exception_chain_head;\n";
+        indent(); (*m_current_out) << frame << ".locals = g_owned_locals.count;\n";
+        indent(); (*m_current_out) << "g_exception_chain_head = &" << frame << ";\n";
 
-        indent(); (*m_current_out) << "if (setjmp(__frame.buffer) == 0) {\n";
+        indent(); (*m_current_out) << "if (ANGARA_SETJMP(" << frame << ".buffer) == 0) {\n";
         m_indent_level++;
 
+        // Finishing the body normally pops the frame.
+        enterScope();
+        m_scopes.back().try_frame = frame;
         transpileStmt(stmt.tryBlock);
+        exitScope(!isTerminator(stmt.tryBlock));
+
+        m_indent_level--;
+        // A throw has already popped the frame before jumping back here.
+        indent(); (*m_current_out) << "} else {\n";
+        m_indent_level++;
+
+        std::string catch_name = localName(stmt.catchName);
+        indent(); (*m_current_out) << "AngaraObject " << catch_name << " = g_current_exception;\n";
+        indent(); (*m_current_out) << "g_current_exception = angara_create_nil();\n";
+
+        // The catch variable owns the exception and drops it when the handler is done.
+        enterScope();
+        declareLocal(catch_name, true);
+        transpileStmt(stmt.catchBlock);
+        exitScope(!isTerminator(stmt.catchBlock));
 
         m_indent_level--;
         indent(); (*m_current_out) << "}\n";
+        m_indent_level--;
+        indent(); (*m_current_out) << "}\n";
+    }
 
-        indent(); (*m_current_out) << "g_exception_chain_head = __frame.prev; // Pop the frame\n";
+    void CTranspiler::transpileTryReturns(const TryStmt& stmt) {
+        // A throw in the body, or a pending exception found after a call in it,
+        // jumps to the catch label; finishing the body normally skips the handler.
+        std::string catch_label = freshTemp("__catch");
+        indent(); (*m_current_out) << "{\n";
+        m_indent_level++;
+
+        enterScope();
+        m_scopes.back().catch_label = catch_label;
+        transpileStmt(stmt.tryBlock);
+        exitScope(!isTerminator(stmt.tryBlock));
 
-        indent(); (*m_current_out) << "if (g_current_exception.type != VAL_NIL) {\n";
+        indent(); (*m_current_out) << "if (0) {\n";
+        indent(); (*m_current_out) << catch_label << ": ;\n";
         m_indent_level++;
 
-        indent(); (*m_current_out) << "AngaraObject " << stmt.catchName.lexeme << " = g_current_exception;\n";
+        std::string catch_name = localName(stmt.catchName);
+        indent(); (*m_current_out) << "AngaraObject " << catch_name << " = g_current_exception;\n";
         indent(); (*m_current_out) << "g_current_exception = angara_create_nil();\n";
 
+        enterScope();
+        declareLocal(catch_name, true);
         transpileStmt(stmt.catchBlock);
+        exitScope(!isTerminator(stmt.catchBlock));
 
         m_indent_level--;
         indent(); (*m_current_out) << "}\n";
@@ -35,4 +81,4 @@ namespace angara {
         indent(); (*m_current_out) << "}\n";
     }
 
-}
\ No newline at end of file
+}
@@ -8,16 +8,24 @@ namespace angara {
     void CTranspiler::transpileVarDecl(const VarDeclStmt& stmt) {
         indent();
         auto var_type = m_type_checker.m_variable_types.at(&stmt);
+        bool boxed = !isUnboxed(var_type);
+        std::string name = localName(stmt.name);
 
-        if (stmt.is_const) (*m_current_out) << "const ";
-        (*m_current_out) << "AngaraObject " << sanitize_name(stmt.name.lexeme) ;
+        // A boxed local owns its reference and is dropped at the end of its scope,
+        // so it stays assignable in C even when it is `const` in Angara.
+        if (stmt.is_const && !boxed) (*m_current_out) << "const ";
+        // A local written inside a `try` must keep its value across the longjmp.
+        if (!m_exception_returns && m_ownership.needsVolatile(stmt.name)) (*m_current_out) << "volatile ";
+        // Typed numbers and bools are declared as raw C variables.
+        (*m_current_out) << getCType(var_type) << " " << name;
 
         if (stmt.initializer) {
-            (*m_current_out) << " = " << transpileExpr(stmt.initializer);
+            (*m_current_out) << " = " << transpileOwned(stmt.initializer, var_type);
         } else {
-            (*m_current_out) << " = angara_create_nil()";
+            (*m_current_out) << " = " << defaultValue(var_type);
         }
         (*m_current_out) << ";\n";
+        declareLocal(name, boxed);
     }
 
 }
\ No newline at end of file
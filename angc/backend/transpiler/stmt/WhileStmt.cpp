@@ -5,13 +5,15 @@
 namespace angara {
 
     void CTranspiler::transpileWhileStmt(const WhileStmt& stmt) {
-        std::string condition_str = "angara_is_truthy(" + transpileExpr(stmt.condition) + ")";
+        std::string condition_str = transpileCondition(stmt.condition);
 
         indent();
         (*m_current_out) << "while (" << condition_str << ") ";
 
-        // Transpile the body of the loop.
+        // Transpile the body of the loop. `break` drops everything down to the loop's scope.
+        enterScope(true);
         transpileStmt(stmt.body);
+        exitScope(false);
     }
 
 }
\ No newline at end of file
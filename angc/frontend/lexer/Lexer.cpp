@@ -119,7 +119,10 @@ namespace angara {
         return m_source[m_current];
     }
 
-    void Lexer::string() {
+    // Scans a string literal up to its closing quote. Text followed by `\(` ends an
+    // interpolation segment instead; `resumed` is set when continuing a string after
+    // the ')' that closed one of its interpolated expressions.
+    void Lexer::string(bool resumed) {
         std::stringstream value; // Use a stringstream to build the final string byte by byte.
 
         while (peek() != '"' && !isAtEnd()) {
@@ -150,6 +153,12 @@ namespace angara {
                     case 'v':  value << '\v'; break;
                     case 'a':  value << '\a'; break;
 
+                        // Interpolation: `\(expr)` embeds the text of an expression.
+                    case '(':
+                        m_interpolations.push_back(0);
+                        addToken(resumed ? TokenType::INTERPOLATION_MIDDLE : TokenType::INTERPOLATION_HEAD, value.str());
+                        return;
+
                         // Octal escapes (e.g., \177)
                     case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7': {
                         std::string octal_str;
@@ -220,7 +229,7 @@ namespace angara {
 
         advance(); // Consume the closing ".
 
-        addToken(TokenType::STRING, value.str());
+        addToken(resumed ? TokenType::INTERPOLATION_TAIL : TokenType::STRING, value.str());
     }
 
     void Lexer::multilineString() {
@@ -288,9 +297,17 @@ namespace angara {
 
             // Single-character tokens
             case '(':
+                if (!m_interpolations.empty()) m_interpolations.back()++;
                 addToken(TokenType::LEFT_PAREN);
                 break;
             case ')':
+                if (!m_interpolations.empty() && m_interpolations.back() == 0) {
+                    // This closes an interpolated expression; the string continues.
+                    m_interpolations.pop_back();
+                    string(true);
+                    break;
+                }
+                if (!m_interpolations.empty()) m_interpolations.back()--;
                 addToken(TokenType::RIGHT_PAREN);
                 break;
             case '{':
@@ -31,6 +31,7 @@ namespace angara {
 
                 // Literals
                 "IDENTIFIER", "STRING", "NUMBER_INT", "NUMBER_FLOAT",
+                "INTERPOLATION_HEAD", "INTERPOLATION_MIDDLE", "INTERPOLATION_TAIL",
 
                 // Keywords
                 "LET", "CONST", "IF", "ELSE", "ORIF",
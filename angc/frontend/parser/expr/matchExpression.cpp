@@ -39,10 +39,12 @@ namespace angara {
                 Token name = consume(TokenType::IDENTIFIER, "Expect property name in pattern.");
                 pattern = std::make_shared<GetExpr>(std::move(pattern), op, std::move(name));
             }
-            std::optional<Token> variable = std::nullopt;
+            std::vector<Token> variables;
             if (match({TokenType::LEFT_PAREN})) {
-                variable = consume(TokenType::IDENTIFIER, "Expect a variable name to bind to the enum variant's value.");
-                consume(TokenType::RIGHT_PAREN, "Expect ')' after pattern variable.");
+                do {
+                    variables.push_back(consume(TokenType::IDENTIFIER, "Expect a variable name to bind to the enum variant's value."));
+                } while (match({TokenType::COMMA}));
+                consume(TokenType::RIGHT_PAREN, "Expect ')' after pattern variables.");
             }
 
             consume(TokenType::COLON, "Expect ':' after match pattern.");
@@ -55,7 +57,7 @@ namespace angara {
                 body = expression();
             }
 
-            cases.push_back({pattern, variable, body});
+            cases.push_back({pattern, variables, body});
 
             // If the next token is not a '}', we expect a comma.
             // This makes the comma a separator, not a terminator.
@@ -11,6 +11,27 @@ namespace angara {
             return std::make_shared<Literal>(previous());
         }
 
+        // Interpolated strings: text segments and embedded expressions alternate,
+        // starting and ending with a (possibly empty) segment.
+        if (match({TokenType::INTERPOLATION_HEAD})) {
+            Token head = previous();
+            std::vector<std::shared_ptr<Expr>> parts;
+            Token segment = head;
+            while (true) {
+                if (!segment.lexeme.empty()) {
+                    parts.push_back(std::make_shared<Literal>(
+                        Token(TokenType::STRING, segment.lexeme, segment.line, segment.column)));
+                }
+                if (segment.type == TokenType::INTERPOLATION_TAIL) break;
+                parts.push_back(expression());
+                if (!match({TokenType::INTERPOLATION_MIDDLE, TokenType::INTERPOLATION_TAIL})) {
+                    throw error(peek(), "Expect ')' after interpolated expression.");
+                }
+                segment = previous();
+            }
+            return std::make_shared<InterpolatedExpr>(head, std::move(parts));
+        }
+
         if (match({TokenType::RETYPE})) {
             Token keyword = previous();
             consume(TokenType::LESS, "Expect '<' after 'retype'.");
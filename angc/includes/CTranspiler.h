@@ -3,9 +3,13 @@
 #include "Expr.h"   // A fictional header including all AST nodes (Expr.h, Stmt.h, etc.)
 #include "Stmt.h"
 #include "TypeChecker.h"
+#include "OwnershipAnalyzer.h"
 #include "ErrorHandler.h"
 #include <sstream>
 #include <string>
+#include <map>
+#include <set>
+#include <tuple>
 
 namespace angara {
 
@@ -13,7 +17,7 @@ namespace angara {
 
     class CTranspiler {
     public:
-        CTranspiler(TypeChecker& type_checker, ErrorHandler& errorHandler);
+        CTranspiler(TypeChecker& type_checker, OwnershipAnalyzer& ownership, ErrorHandler& errorHandler);
 
         /**
          * @brief The main entry point for transpilation.
@@ -44,10 +48,30 @@ namespace angara {
 
         void transpileClassNew(const ClassStmt &stmt);
 
+        void transpileClassDrop(const ClassStmt &stmt);
+
+        void transpileClassTraverse(const ClassStmt &stmt);
+
         void transpileDataStruct(const DataStmt &stmt);
 
         void transpileDataConstructor(const DataStmt &stmt);
 
+        void transpileDataDrop(const DataStmt &stmt);
+
+        void transpileDataTraverse(const DataStmt &stmt);
+
+        void transpileEnumDrop(const EnumStmt &stmt);
+
+        void transpileEnumTraverse(const EnumStmt &stmt);
+
+        // The immortal instance shared by every use of a nullary variant.
+        std::string enumSingletonName(const std::string& enum_name, const std::string& variant_name);
+
+        // The member path of a payload field within an enum's payload union.
+        std::string enumPayloadField(const std::string& variant_name, size_t index);
+
+        std::vector<std::pair<std::string, std::vector<std::string>>> enumBoxedPayloads(const EnumType& enum_type);
+
         void transpileStruct(const ClassStmt &stmt);
 
         void pass_5_generate_main(const std::vector<std::shared_ptr<Stmt>>& statements,
@@ -61,6 +85,8 @@ namespace angara {
         void transpileBlock(const BlockStmt& stmt);
 
         std::string transpileVarExpr(const VarExpr &expr);
+        // The C l-value for a variable, in its declared (un-narrowed) representation.
+        std::string transpileVarName(const VarExpr &expr);
 
         void transpileIfStmt(const IfStmt& stmt);
 
@@ -87,6 +113,8 @@ namespace angara {
         void transpileTryStmt(const TryStmt &stmt);
 
         void transpileForInStmt(const ForInStmt &stmt);
+        // The `range(...)` call a for-in loop iterates over, if it is one.
+        std::shared_ptr<const CallExpr> rangeCall(const std::shared_ptr<Expr>& expr);
 
         std::string transpileSubscriptExpr(const SubscriptExpr &expr);
         std::string transpileMatchExpr(const MatchExpr& expr);
@@ -99,6 +127,10 @@ namespace angara {
 
         std::string transpileLiteral(const Literal& expr);
         std::string transpileBinary(const Binary& expr);
+        // String `+` chains and interpolations are flattened into their pieces and
+        // built by a single runtime call that sizes the result once.
+        void collectStringPieces(const std::shared_ptr<Expr>& expr, std::vector<std::shared_ptr<Expr>>& pieces);
+        std::string transpileStringPieces(const std::vector<std::shared_ptr<Expr>>& pieces);
 
         std::string transpileGrouping(const Grouping &expr);
 
@@ -123,10 +155,101 @@ namespace angara {
         void transpileGlobalFunction(const FuncStmt& stmt, const std::string& module_name);
         std::string transpileSizeofExpr(const SizeofExpr& expr);
         std::string transpileRetypeExpr(const RetypeExpr& expr);
+        std::string transpileInterpolatedExpr(const InterpolatedExpr& expr);
 
 
         // --- Utility Methods ---
         std::string getCType(const std::shared_ptr<Type>& angaraType);
+        bool isUnboxed(const std::shared_ptr<Type>& angaraType);
+        std::string boxValue(const std::string& code, const std::shared_ptr<Type>& type);
+        std::string unboxValue(const std::string& code, const std::shared_ptr<Type>& type);
+        // Unboxes a value the generated code owns, releasing the box.
+        std::string unboxOwned(const std::string& code, const std::shared_ptr<Type>& type);
+        std::string convertValue(const std::string& code, const std::shared_ptr<Type>& from, const std::shared_ptr<Type>& to);
+        std::string defaultValue(const std::shared_ptr<Type>& type);
+        // "i64", "f64" or "bool" for a list type whose elements are stored packed, else "".
+        std::string packedListElement(const std::shared_ptr<Type>& list_type);
+        static std::string packedListKind(const std::string& element);
+
+        // Transpiles an expression and converts it to the C representation of `target`.
+        std::string transpileExprAs(const std::shared_ptr<Expr>& expr, const std::shared_ptr<Type>& target);
+        // Transpiles an expression that must be passed as a generic AngaraObject.
+        std::string transpileBoxed(const std::shared_ptr<Expr>& expr);
+        // Transpiles an expression used as a condition into a plain C truth value.
+        std::string transpileCondition(const std::shared_ptr<Expr>& expr);
+        // Returns a reference to the immortal pool object for a string literal.
+        std::string transpileStringLiteral(const std::string& text);
+        // Emits the module's string literal pool and its interning function.
+        std::string generateLiteralPool(const std::string& module_name);
+
+        // --- Ownership Helpers ---
+        // Built with ANGARA_NAN_BOXING, an i64 too wide for the NaN-box payload is a
+        // counted heap cell, so boxing an integer yields a reference to release.
+#ifdef ANGARA_NAN_BOXING
+        static constexpr bool m_counted_integers = true;
+#else
+        static constexpr bool m_counted_integers = false;
+#endif
+        // Owned temporaries (C name, initializer) that an expression only borrows.
+        using TempList = std::vector<std::pair<std::string, std::string>>;
+
+        // True if evaluating `expr` yields a counted reference the consumer must release.
+        bool yieldsOwnedObject(const std::shared_ptr<Expr>& expr);
+        // Transpiles `expr` into an owned reference in the C representation of `target`,
+        // moving a local at its last use and taking a new reference to anything borrowed.
+        std::string transpileOwned(const std::shared_ptr<Expr>& expr, const std::shared_ptr<Type>& target);
+        // Transpiles `expr` for a position that only borrows it (boxed, or as `target`).
+        // An owned result is parked in a temporary that `releaseTemps` drops afterwards.
+        std::string transpileBorrowed(const std::shared_ptr<Expr>& expr, TempList& temps);
+        std::string transpileBorrowedAs(const std::shared_ptr<Expr>& expr, const std::shared_ptr<Type>& target, TempList& temps);
+        // Transpiles an argument for a typed parameter, honouring the callee's convention.
+        std::string transpileArgument(const std::shared_ptr<Expr>& expr, const std::shared_ptr<Type>& param_type,
+                                      bool owned, TempList& temps);
+        // Wraps `code` so the temporaries are released once it has been evaluated.
+        std::string releaseTemps(const std::string& code, const TempList& temps, bool is_void = false);
+        std::string freshTemp(const std::string& prefix);
+        static bool isOwnedParam(const std::shared_ptr<FunctionType>& type, size_t index);
+
+        // --- Drop Scopes ---
+        // Every C block the generated code opens is mirrored by a scope listing the
+        // locals declared in it. Owned locals are dropped when control leaves the block.
+        // Without exception returns they are also pushed on the runtime's owned-locals
+        // stack while they live, so a throw can drop the ones in the frames it unwinds.
+        void enterScope(bool is_loop = false);
+        void exitScope(bool emit_drops);
+        void declareLocal(const std::string& name, bool owned);
+        // The C name for a local declared at `name`. A local that shadows one still in
+        // scope gets a name of its own, suffixed with its position, so that leaving
+        // the inner scope early can still drop the outer one.
+        std::string localName(const Token& name);
+        // The C name a local symbol was declared under.
+        std::string localName(const Symbol& symbol);
+        // Drops the owned locals of every scope from `first_scope` up, innermost first,
+        // popping them and the exception frames of any `try` bodies on the way out.
+        void emitDrops(size_t first_scope, const std::string& except = "");
+        // Index of the innermost loop scope, for `break`.
+        size_t innermostLoopScope() const;
+
+        // --- Exception Returns ---
+        // Built with ANGARA_EXCEPTION_RETURNS, a throw leaves the exception pending
+        // and returns. `checkException` follows a call with a test for one, and
+        // `propagateException` is the code that carries it on: to the innermost
+        // `catch` of this function, or out of the function with a zero result.
+#ifdef ANGARA_EXCEPTION_RETURNS
+        static constexpr bool m_exception_returns = true;
+#else
+        static constexpr bool m_exception_returns = false;
+#endif
+        std::string checkException(const std::string& call, bool is_void);
+        std::string propagateException();
+        void transpileTryReturns(const TryStmt& stmt);
+        bool isOwnedLocal(const std::string& name) const;
+        static bool isTerminator(const std::shared_ptr<Stmt>& stmt);
+        // False only for expressions that read values and compute on them, whose
+        // evaluation order cannot be observed.
+        static bool hasSideEffects(const std::shared_ptr<Expr>& expr);
+        // `x = Data(...)` that overwrites the fields of a unique `x` in place.
+        std::string transpileReuseAssign(const AssignExpr& expr, const std::string& lhs_str);
 
         static std::string join_strings(const std::vector<std::string> &elements, const std::string &separator);
 
@@ -142,6 +265,7 @@ namespace angara {
 
     private:
         TypeChecker& m_type_checker;
+        OwnershipAnalyzer& m_ownership;
         ErrorHandler& m_errorHandler;
 
         // We now have dedicated streams for different parts of the C file.
@@ -163,6 +287,36 @@ namespace angara {
         // An empty string means we are in the global scope.
         std::string m_current_class_name;
         std::string m_current_module_name;
+        // The declared return type of the function or method being transpiled.
+        std::shared_ptr<Type> m_current_return_type;
+        // This module's string literals, each a static immortal AngaraString (text -> C name).
+        std::map<std::string, std::string> m_string_literals;
+
+        struct LocalVar { std::string name; bool owned; };
+        // `try_frame` names the exception frame a `try` body pushed; leaving the
+        // body any way other than a throw pops it. With exception returns, a `try`
+        // body instead names the label of its `catch` in `catch_label`.
+        struct DropScope {
+            std::vector<LocalVar> locals;
+            bool is_loop = false;
+            std::string try_frame;
+            std::string catch_label;
+        };
+        std::vector<DropScope> m_scopes;
+        // The locals renamed by `localName`, keyed by their declaration (line, column, name).
+        std::map<std::tuple<int, int, std::string>, std::string> m_local_names;
+        int m_temp_counter = 0;
+        // This module's data declarations, for rebuilding data objects in place.
+        std::map<std::string, const DataStmt*> m_data_stmts;
+        // This module's Angara functions. Calls to them are direct C calls; only the
+        // ones read as values (plus exported ones and main) get a closure.
+        std::map<std::string, const FuncStmt*> m_global_functions;
+        std::set<std::string> m_function_values;
+
+        // Canonical types used to pick a C representation for intermediate values.
+        const std::shared_ptr<Type> m_i64_type = std::make_shared<PrimitiveType>("i64");
+        const std::shared_ptr<Type> m_f64_type = std::make_shared<PrimitiveType>("f64");
+        const std::shared_ptr<Type> m_any_type = std::make_shared<AnyType>();
         void transpileBreakStmt(const BreakStmt &stmt);
         std::string sanitize_name(const std::string &name);
         std::string escape_c_string(const std::string &str);
@@ -18,6 +18,8 @@ namespace angara {
         const std::string name;
         // A map from exported symbol name to its Type.
         std::map<std::string, std::shared_ptr<Type>> exports;
+        // The exports declared with `func`, callable directly as `angara_f_<module>_<name>`.
+        std::set<std::string> functions;
         bool is_native = false;
 
         explicit ModuleType(std::string name)
@@ -34,6 +34,7 @@ namespace angara {
     struct MatchExpr;
     struct SizeofExpr;
     struct RetypeExpr;
+    struct InterpolatedExpr;
 
     // The Visitor interface for expressions
     class ExprVisitor {
@@ -60,6 +61,7 @@ namespace angara {
         virtual std::any visit(const MatchExpr& expr) = 0;
         virtual std::any visit(const SizeofExpr& expr) = 0;
         virtual std::any visit(const RetypeExpr& expr) = 0;
+        virtual std::any visit(const InterpolatedExpr& expr) = 0;
 
     };
 
@@ -277,7 +279,7 @@ namespace angara {
     // A single case within a match expression, e.g., `case Pattern: body`
     struct MatchCase {
         const std::shared_ptr<Expr> pattern; // e.g., `Color.Green` or `WebEvent.KeyPress`
-        const std::optional<Token> variable; // e.g., the `key` in `KeyPress(key)`
+        const std::vector<Token> variables;  // e.g., the `key` in `KeyPress(key)`, or `x, y` in `Move(x, y)`
         const std::shared_ptr<Expr> body;
     };
 
@@ -323,4 +325,18 @@ namespace angara {
             return visitor.visit(*this);
         }
     };
+
+    // An interpolated string, e.g. `"fib(\(n)) = \(result)"`. `parts` holds its
+    // text segments (as string literals) and embedded expressions, in order.
+    struct InterpolatedExpr : Expr {
+        const Token token; // The opening segment, for location info
+        const std::vector<std::shared_ptr<Expr>> parts;
+
+        InterpolatedExpr(Token token, std::vector<std::shared_ptr<Expr>> parts)
+            : token(std::move(token)), parts(std::move(parts)) {}
+
+        std::any accept(ExprVisitor& visitor) const override {
+            return visitor.visit(*this);
+        }
+    };
 }
\ No newline at end of file
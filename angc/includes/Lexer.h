@@ -23,7 +23,7 @@ namespace angara {
         bool match(char expected);
         char peek();
         char peekNext();
-        void string();
+        void string(bool resumed = false);
         void number();
         void identifier();
         void addToken(TokenType type);
@@ -37,6 +37,9 @@ namespace angara {
         int m_line = 1;
         int m_column = 1;
         bool m_isAtStartOfLine = true;
+        // One entry per `\(` interpolation still open, innermost last: how many
+        // parentheses inside it are open, so its closing ')' can be told apart.
+        std::vector<int> m_interpolations;
 
         // Map to hold all reserved keywords
         static const std::map<std::string, TokenType> keywords;
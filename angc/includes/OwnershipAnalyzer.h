@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Expr.h"
+#include "Stmt.h"
+#include "TypeChecker.h"
+#include <map>
+#include <set>
+#include <vector>
+
+namespace angara {
+
+    /*
+    ===========================================================================
+     Ownership Analysis
+    ---------------------------------------------------------------------------
+     A pass over the type-checked AST that runs between the TypeChecker and
+     the CTranspiler. It decides who owns every reference the generated code
+     handles, so the transpiler can emit exactly the reference counting
+     operations that are needed and no more (in the spirit of Perceus):
+
+      - every expression either produces a new reference (Owned), borrows one
+        that lives elsewhere (Borrowed), or is an immortal constant (Static);
+      - parameters are borrowed unless the callee stores them, in which case
+        the caller hands over its reference (FunctionType::owned_params);
+      - the last use of a local that is consumed moves the reference instead
+        of taking a new one and dropping the old one;
+      - for-in loops whose body cannot mutate the list borrow its items;
+      - `x = Data(...)` rebuilds a unique `x` in place instead of allocating.
+    ===========================================================================
+    */
+    class OwnershipAnalyzer {
+    public:
+        enum class Ownership { Borrowed, Owned, Static };
+
+        explicit OwnershipAnalyzer(TypeChecker& type_checker);
+
+        // Analyzes every function and method of the module. Must run before transpiling.
+        void analyze(const std::vector<std::shared_ptr<Stmt>>& statements);
+
+        // Who owns the reference produced by evaluating `expr`.
+        [[nodiscard]] Ownership ownership(const std::shared_ptr<Expr>& expr) const;
+        [[nodiscard]] bool isOwned(const std::shared_ptr<Expr>& expr) const;
+
+        // True if this read of a local is its last one and may move the reference out.
+        [[nodiscard]] bool canMove(const VarExpr& expr) const;
+        // True if the loop body cannot release the list's items, so they can be borrowed.
+        [[nodiscard]] bool borrowsItems(const ForInStmt& stmt) const;
+        // True if the local declared at `name` is written inside a `try` it was declared
+        // outside of, and so must survive a longjmp back into its frame.
+        [[nodiscard]] bool needsVolatile(const Token& name) const;
+        // True for `x = Data(...)` where `x` is a local of that same data type.
+        [[nodiscard]] bool isReuseSite(const AssignExpr& expr) const;
+
+    private:
+        // A local is identified by the position of the token that declared it.
+        using DeclKey = std::pair<int, int>;
+
+        struct Declaration { int loop_depth; int try_depth; };
+        struct Use { const VarExpr* expr; int loop_depth; int try_depth; int statement; };
+
+        void analyzeFunction(const FuncStmt& stmt, const std::shared_ptr<FunctionType>& type);
+        void walkStmt(const std::shared_ptr<Stmt>& stmt);
+        void walkExpr(const std::shared_ptr<Expr>& expr);
+        void declare(const Token& name);
+        // Records that `expr` is stored somewhere; a parameter stored this way becomes owned.
+        void consume(const std::shared_ptr<Expr>& expr);
+        // True if `expr` is a call whose callee cannot run arbitrary code.
+        bool isTransparentCall(const CallExpr& expr) const;
+        bool mayReleaseItems(const std::shared_ptr<Stmt>& stmt) const;
+        bool mayReleaseItems(const std::shared_ptr<Expr>& expr) const;
+        bool isConstructorCall(const CallExpr& expr) const;
+        const Symbol* resolveLocal(const VarExpr& expr) const;
+
+        TypeChecker& m_type_checker;
+
+        // --- Results ---
+        std::set<const VarExpr*> m_moves;
+        std::set<const ForInStmt*> m_borrowing_loops;
+        std::set<DeclKey> m_volatile_locals;
+
+        // --- Per-function state ---
+        const FuncStmt* m_current_function = nullptr;
+        std::vector<bool> m_owned_params;
+        std::map<DeclKey, Declaration> m_declarations;
+        std::map<DeclKey, std::vector<Use>> m_uses;
+        int m_loop_depth = 0;
+        int m_try_depth = 0;
+        int m_statement = 0;
+    };
+
+} // namespace angara
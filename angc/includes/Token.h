@@ -30,6 +30,8 @@ namespace angara {
 
         // Literals
         IDENTIFIER, STRING, NUMBER_INT, NUMBER_FLOAT,
+        // The text of an interpolated string before, between and after its `\(...)` parts.
+        INTERPOLATION_HEAD, INTERPOLATION_MIDDLE, INTERPOLATION_TAIL,
 
         // Keywords
         LET, CONST, IF, ELSE, ORIF,
@@ -25,6 +25,7 @@ namespace angara {
         NIL,
         THREAD,
         MUTEX,
+        STRING_BUILDER,
         MODULE,
         EXCEPTION,
         OPTIONAL,
@@ -94,6 +95,9 @@ namespace angara {
 
         const bool is_variadic;
         bool is_foreign = false;
+        // Filled in by the OwnershipAnalyzer: true for each parameter the callee takes
+        // ownership of. Callers pass those as owned references, all others are borrowed.
+        std::vector<bool> owned_params;
 
         // Update constructor to accept the flag, defaulting to false.
         FunctionType(std::vector<std::shared_ptr<Type>> params, std::shared_ptr<Type> ret, bool is_variadic = false)
@@ -239,6 +243,11 @@ namespace angara {
         std::string toString() const override { return "Mutex"; }
     };
 
+    struct StringBuilderType : Type {
+        StringBuilderType() : Type(TypeKind::STRING_BUILDER) {}
+        std::string toString() const override { return "StringBuilder"; }
+    };
+
     struct NilType : Type {
         NilType() : Type(TypeKind::NIL) {}
         std::string toString() const override { return "nil"; }
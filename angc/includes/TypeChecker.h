@@ -71,6 +71,7 @@ namespace angara {
         std::any visit(const MatchExpr& expr) override;
         std::any visit(const SizeofExpr& expr) override;
         std::any visit(const RetypeExpr& expr) override;
+        std::any visit(const InterpolatedExpr& expr) override;
 
         void visit(std::shared_ptr<const ContractStmt> stmt) override;
         void defineContractHeader(const ContractStmt &stmt);
@@ -134,6 +135,7 @@ namespace angara {
         std::shared_ptr<Type> m_type_error;
         std::shared_ptr<Type> m_type_thread;
         std::shared_ptr<Type> m_type_mutex;
+        std::shared_ptr<Type> m_type_string_builder;
         std::shared_ptr<Type> m_type_exception;
         std::shared_ptr<Type> m_type_c_ptr;
         CompilerDriver& m_driver;
@@ -166,7 +168,10 @@ namespace angara {
 
         bool check_type_compatibility(const std::shared_ptr<Type> &expected, const std::shared_ptr<Type> &actual);
 
-        void check_spawn_call(const CallExpr &call, const std::vector<std::shared_ptr<Type>> &arg_types);
+        void check_spawn_call(const CallExpr &call, const std::vector<std::shared_ptr<Type>> &arg_types,
+                              const std::string &builtin);
+
+        void check_range_call(const CallExpr &call, const std::vector<std::shared_ptr<Type>> &arg_types);
 
         void check_function_call(const CallExpr &call, const std::shared_ptr<FunctionType> &func_type,
                                  const std::vector<std::shared_ptr<Type>> &arg_types);
@@ -7,6 +7,180 @@
 #include <stdio.h>
 #include <ctype.h> // For isdigit, isspace
 #include "../runtime/angara_runtime.h"
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+// --- Search Kernels ---
+// Byte search and counting, and substring search, each in a portable version
+// and, on x86-64, SSE2 and AVX2 versions picked once at run time from what the
+// CPU supports. Substring search compares the needle's first and last bytes
+// against a whole block of positions at once and only runs memcmp where both
+// match, so it touches each byte of the text about once.
+#define NOT_FOUND ((size_t)-1)
+
+typedef struct {
+    size_t (*find_byte)(const char* text, size_t length, char byte);
+    size_t (*count_byte)(const char* text, size_t length, char byte);
+    size_t (*find)(const char* text, size_t length, const char* needle, size_t needle_length);
+} SearchKernels;
+
+static size_t find_byte_scalar(const char* text, size_t length, char byte) {
+    const char* found = memchr(text, byte, length);
+    return found != NULL ? (size_t)(found - text) : NOT_FOUND;
+}
+
+static size_t count_byte_scalar(const char* text, size_t length, char byte) {
+    size_t count = 0;
+    for (size_t i = 0; i < length; i++) count += text[i] == byte;
+    return count;
+}
+
+static size_t find_scalar(const char* text, size_t length, const char* needle, size_t needle_length) {
+    if (needle_length == 0) return 0;
+    if (needle_length > length) return NOT_FOUND;
+    size_t last_start = length - needle_length;
+    for (size_t i = 0; i <= last_start;) {
+        size_t offset = find_byte_scalar(text + i, last_start - i + 1, needle[0]);
+        if (offset == NOT_FOUND) return NOT_FOUND;
+        i += offset;
+        if (memcmp(text + i + 1, needle + 1, needle_length - 1) == 0) return i;
+        i++;
+    }
+    return NOT_FOUND;
+}
+
+#if defined(__x86_64__)
+static size_t find_byte_sse2(const char* text, size_t length, char byte) {
+    __m128i wanted = _mm_set1_epi8(byte);
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i*)(text + i));
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(block, wanted));
+        if (mask != 0) return i + (size_t)__builtin_ctz(mask);
+    }
+    size_t rest = find_byte_scalar(text + i, length - i, byte);
+    return rest == NOT_FOUND ? NOT_FOUND : i + rest;
+}
+
+static size_t count_byte_sse2(const char* text, size_t length, char byte) {
+    __m128i wanted = _mm_set1_epi8(byte);
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i*)(text + i));
+        count += (size_t)__builtin_popcount((unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(block, wanted)));
+    }
+    return count + count_byte_scalar(text + i, length - i, byte);
+}
+
+static size_t find_sse2(const char* text, size_t length, const char* needle, size_t needle_length) {
+    if (needle_length < 2 || needle_length > length) {
+        if (needle_length == 1) return find_byte_sse2(text, length, needle[0]);
+        return find_scalar(text, length, needle, needle_length);
+    }
+    __m128i first = _mm_set1_epi8(needle[0]);
+    __m128i last = _mm_set1_epi8(needle[needle_length - 1]);
+    size_t i = 0;
+    for (; i + needle_length - 1 + 16 <= length; i += 16) {
+        __m128i block_first = _mm_loadu_si128((const __m128i*)(text + i));
+        __m128i block_last = _mm_loadu_si128((const __m128i*)(text + i + needle_length - 1));
+        unsigned mask = (unsigned)_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last)));
+        while (mask != 0) {
+            size_t position = i + (size_t)__builtin_ctz(mask);
+            if (memcmp(text + position + 1, needle + 1, needle_length - 2) == 0) return position;
+            mask &= mask - 1;
+        }
+    }
+    size_t rest = find_scalar(text + i, length - i, needle, needle_length);
+    return rest == NOT_FOUND ? NOT_FOUND : i + rest;
+}
+
+__attribute__((target("avx2")))
+static size_t find_byte_avx2(const char* text, size_t length, char byte) {
+    __m256i wanted = _mm256_set1_epi8(byte);
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        __m256i block = _mm256_loadu_si256((const __m256i*)(text + i));
+        unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, wanted));
+        if (mask != 0) return i + (size_t)__builtin_ctz(mask);
+    }
+    size_t rest = find_byte_sse2(text + i, length - i, byte);
+    return rest == NOT_FOUND ? NOT_FOUND : i + rest;
+}
+
+__attribute__((target("avx2,popcnt")))
+static size_t count_byte_avx2(const char* text, size_t length, char byte) {
+    __m256i wanted = _mm256_set1_epi8(byte);
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        __m256i block = _mm256_loadu_si256((const __m256i*)(text + i));
+        count += (size_t)__builtin_popcount((unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, wanted)));
+    }
+    return count + count_byte_sse2(text + i, length - i, byte);
+}
+
+__attribute__((target("avx2")))
+static size_t find_avx2(const char* text, size_t length, const char* needle, size_t needle_length) {
+    if (needle_length < 2 || needle_length > length) {
+        if (needle_length == 1) return find_byte_avx2(text, length, needle[0]);
+        return find_scalar(text, length, needle, needle_length);
+    }
+    __m256i first = _mm256_set1_epi8(needle[0]);
+    __m256i last = _mm256_set1_epi8(needle[needle_length - 1]);
+    size_t i = 0;
+    for (; i + needle_length - 1 + 32 <= length; i += 32) {
+        __m256i block_first = _mm256_loadu_si256((const __m256i*)(text + i));
+        __m256i block_last = _mm256_loadu_si256((const __m256i*)(text + i + needle_length - 1));
+        unsigned mask = (unsigned)_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(block_first, first), _mm256_cmpeq_epi8(block_last, last)));
+        while (mask != 0) {
+            size_t position = i + (size_t)__builtin_ctz(mask);
+            if (memcmp(text + position + 1, needle + 1, needle_length - 2) == 0) return position;
+            mask &= mask - 1;
+        }
+    }
+    size_t rest = find_sse2(text + i, length - i, needle, needle_length);
+    return rest == NOT_FOUND ? NOT_FOUND : i + rest;
+}
+#endif
+
+static SearchKernels g_kernels;
+static pthread_once_t g_kernels_once = PTHREAD_ONCE_INIT;
+
+static void select_kernels(void) {
+    g_kernels = (SearchKernels){ find_byte_scalar, count_byte_scalar, find_scalar };
+#if defined(__x86_64__)
+    // SSE2 is part of x86-64 itself; AVX2 has to be asked for.
+    g_kernels = (SearchKernels){ find_byte_sse2, count_byte_sse2, find_sse2 };
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        g_kernels = (SearchKernels){ find_byte_avx2, count_byte_avx2, find_avx2 };
+    }
+#endif
+}
+
+static const SearchKernels* kernels(void) {
+    pthread_once(&g_kernels_once, select_kernels);
+    return &g_kernels;
+}
+
+// Non-overlapping occurrences of `needle`; an empty needle matches between
+// every two bytes, as in Python.
+static size_t count_occurrences(const char* text, size_t length, const char* needle, size_t needle_length) {
+    if (needle_length == 0) return length + 1;
+    if (needle_length == 1) return kernels()->count_byte(text, length, needle[0]);
+    size_t count = 0;
+    for (size_t i = 0; i + needle_length <= length;) {
+        size_t found = kernels()->find(text + i, length - i, needle, needle_length);
+        if (found == NOT_FOUND) break;
+        count++;
+        i += found + needle_length;
+    }
+    return count;
+}
 
 // --- Function Implementations ---
 
@@ -16,7 +190,7 @@ AngaraObject Angara_adv_string_get(int arg_count, AngaraObject* args) {
         angara_throw_error("get(string, index) expects a string and an integer.");
         return angara_create_nil();
     }
-    AngaraString* str = (AngaraString*)args[0].as.obj;
+    AngaraString* str = (AngaraString*)AS_OBJ(args[0]);
     int64_t index = AS_I64(args[1]);
 
     if (index < 0 || (size_t)index >= str->length) {
@@ -24,21 +198,19 @@ AngaraObject Angara_adv_string_get(int arg_count, AngaraObject* args) {
         return angara_create_nil();
     }
 
-    // Create a new, null-terminated C string of length 1.
-    char* char_buf = (char*)malloc(2);
-    char_buf[0] = str->chars[index];
-    char_buf[1] = '\0';
-
-    return angara_create_string_no_copy(char_buf, 1);
+    // One-byte strings are preallocated by the runtime, so this never allocates.
+    return angara_create_string_with_len(str->chars + index, 1);
 }
 
-// Extracts a substring. Handles bounds checking.
+// Extracts a substring. Handles bounds checking. The result shares the
+// original's bytes rather than copying them, so cutting tokens out of a large
+// input allocates one small object per token.
 AngaraObject Angara_adv_string_substring(int arg_count, AngaraObject* args) {
     if (arg_count != 3 || !IS_STRING(args[0]) || !IS_I64(args[1]) || !IS_I64(args[2])) {
         angara_throw_error("substring(string, start, end) expects a string and two integers.");
         return angara_create_nil();
     }
-    AngaraString* str = (AngaraString*)args[0].as.obj;
+    AngaraString* str = (AngaraString*)AS_OBJ(args[0]);
     int64_t start = AS_I64(args[1]);
     int64_t end = AS_I64(args[2]);
 
@@ -48,11 +220,7 @@ AngaraObject Angara_adv_string_substring(int arg_count, AngaraObject* args) {
     }
 
     size_t len = end - start;
-    char* sub_buf = (char*)malloc(len + 1);
-    memcpy(sub_buf, str->chars + start, len);
-    sub_buf[len] = '\0';
-
-    return angara_create_string_no_copy(sub_buf, len);
+    return angara_string_slice(args[0], (size_t)start, len);
 }
 
 // Checks if a single-character string is a digit.
@@ -61,7 +229,7 @@ AngaraObject Angara_adv_string_is_digit(int arg_count, AngaraObject* args) {
         angara_throw_error("is_digit(char) expects a string.");
         return angara_create_nil();
     }
-    AngaraString* str = (AngaraString*)args[0].as.obj;
+    AngaraString* str = (AngaraString*)AS_OBJ(args[0]);
     if (str->length != 1) {
         return angara_create_bool(false);
     }
@@ -74,7 +242,7 @@ AngaraObject Angara_adv_string_is_whitespace(int arg_count, AngaraObject* args)
         angara_throw_error("is_whitespace(char) expects a string.");
         return angara_create_nil();
     }
-    AngaraString* str = (AngaraString*)args[0].as.obj;
+    AngaraString* str = (AngaraString*)AS_OBJ(args[0]);
     if (str->length != 1) {
         return angara_create_bool(false);
     }
@@ -95,10 +263,10 @@ AngaraObject Angara_adv_string_pad_end(int arg_count, AngaraObject* args) {
     }
 
     // 2. Unbox the Angara arguments into C types.
-    const char* base_str = AS_CSTRING(args[0]);
-    size_t base_len = AS_STRING(args[0])->length;
+    const char* base_str = AS_STRING_CHARS(args[0]);
+    size_t base_len = AS_STRING_LENGTH(args[0]);
     int64_t target_len = AS_I64(args[1]);
-    const char* pad_str = AS_CSTRING(args[2]);
+    const char* pad_str = AS_STRING_CHARS(args[2]);
 
     // 3. Perform the logic.
     if ((int64_t)base_len >= target_len) {
@@ -128,6 +296,252 @@ AngaraObject Angara_adv_string_pad_end(int arg_count, AngaraObject* args) {
     return angara_create_string_no_copy(result_buf, target_len);
 }
 
+// --- Searching ---
+
+// Checks the common (string, string) argument shape shared by the search functions.
+static bool check_two_strings(int arg_count, AngaraObject* args, const char* message) {
+    if (arg_count != 2 || !IS_STRING(args[0]) || !IS_STRING(args[1])) {
+        angara_throw_error(message);
+        return false;
+    }
+    return true;
+}
+
+// Index of the first occurrence of `needle` in `text`, or -1.
+AngaraObject Angara_adv_string_find(int arg_count, AngaraObject* args) {
+    if (!check_two_strings(arg_count, args, "find(text, needle) expects two strings.")) return angara_create_nil();
+    size_t found = kernels()->find(AS_STRING_CHARS(args[0]), AS_STRING_LENGTH(args[0]),
+                                   AS_STRING_CHARS(args[1]), AS_STRING_LENGTH(args[1]));
+    return angara_create_i64(found == NOT_FOUND ? -1 : (int64_t)found);
+}
+
+// Like find, but starts looking at byte `start`.
+AngaraObject Angara_adv_string_find_from(int arg_count, AngaraObject* args) {
+    if (arg_count != 3 || !IS_STRING(args[0]) || !IS_STRING(args[1]) || !IS_I64(args[2])) {
+        angara_throw_error("find_from(text, needle, start) expects two strings and an integer.");
+        return angara_create_nil();
+    }
+    size_t length = AS_STRING_LENGTH(args[0]);
+    int64_t start = AS_I64(args[2]);
+    if (start < 0 || (size_t)start > length) {
+        angara_throw_error("find_from() start index is out of bounds.");
+        return angara_create_nil();
+    }
+    size_t found = kernels()->find(AS_STRING_CHARS(args[0]) + start, length - (size_t)start,
+                                   AS_STRING_CHARS(args[1]), AS_STRING_LENGTH(args[1]));
+    return angara_create_i64(found == NOT_FOUND ? -1 : start + (int64_t)found);
+}
+
+// Index of the last occurrence of `needle` in `text`, or -1.
+AngaraObject Angara_adv_string_rfind(int arg_count, AngaraObject* args) {
+    if (!check_two_strings(arg_count, args, "rfind(text, needle) expects two strings.")) return angara_create_nil();
+    const char* text = AS_STRING_CHARS(args[0]);
+    size_t length = AS_STRING_LENGTH(args[0]);
+    const char* needle = AS_STRING_CHARS(args[1]);
+    size_t needle_length = AS_STRING_LENGTH(args[1]);
+    if (needle_length > length) return angara_create_i64(-1);
+    for (size_t i = length - needle_length + 1; i-- > 0;) {
+        if (memcmp(text + i, needle, needle_length) == 0) return angara_create_i64((int64_t)i);
+    }
+    return angara_create_i64(-1);
+}
+
+// Number of non-overlapping occurrences of `needle` in `text`.
+AngaraObject Angara_adv_string_count(int arg_count, AngaraObject* args) {
+    if (!check_two_strings(arg_count, args, "count(text, needle) expects two strings.")) return angara_create_nil();
+    return angara_create_i64((int64_t)count_occurrences(AS_STRING_CHARS(args[0]), AS_STRING_LENGTH(args[0]),
+                                                        AS_STRING_CHARS(args[1]), AS_STRING_LENGTH(args[1])));
+}
+
+AngaraObject Angara_adv_string_starts_with(int arg_count, AngaraObject* args) {
+    if (!check_two_strings(arg_count, args, "starts_with(text, prefix) expects two strings.")) return angara_create_nil();
+    size_t length = AS_STRING_LENGTH(args[0]);
+    size_t prefix_length = AS_STRING_LENGTH(args[1]);
+    return angara_create_bool(prefix_length <= length &&
+                              memcmp(AS_STRING_CHARS(args[0]), AS_STRING_CHARS(args[1]), prefix_length) == 0);
+}
+
+AngaraObject Angara_adv_string_ends_with(int arg_count, AngaraObject* args) {
+    if (!check_two_strings(arg_count, args, "ends_with(text, suffix) expects two strings.")) return angara_create_nil();
+    size_t length = AS_STRING_LENGTH(args[0]);
+    size_t suffix_length = AS_STRING_LENGTH(args[1]);
+    return angara_create_bool(suffix_length <= length &&
+                              memcmp(AS_STRING_CHARS(args[0]) + length - suffix_length,
+                                     AS_STRING_CHARS(args[1]), suffix_length) == 0);
+}
+
+// --- Splitting and Joining ---
+// The pieces of split, split_lines and trim are slices of the input, and every
+// result list or string is sized before anything is written to it.
+
+// Appends text[start, start + length) to `list` as a slice of `source`.
+static void push_piece(AngaraObject list, AngaraObject source, size_t start, size_t length) {
+    AngaraObject piece = angara_string_slice(source, start, length);
+    angara_list_push(list, piece);
+    angara_decref(piece);
+}
+
+// Splits `text` at every occurrence of `separator`.
+// Angara signature: func split(text as string, separator as string) -> list<string>
+AngaraObject Angara_adv_string_split(int arg_count, AngaraObject* args) {
+    if (!check_two_strings(arg_count, args, "split(text, separator) expects two strings.")) return angara_create_nil();
+    const char* text = AS_STRING_CHARS(args[0]);
+    size_t length = AS_STRING_LENGTH(args[0]);
+    const char* separator = AS_STRING_CHARS(args[1]);
+    size_t separator_length = AS_STRING_LENGTH(args[1]);
+    if (separator_length == 0) {
+        angara_throw_error("split() separator must not be empty.");
+        return angara_create_nil();
+    }
+
+    // 1. Count the pieces so the list is allocated once.
+    size_t pieces = count_occurrences(text, length, separator, separator_length) + 1;
+    AngaraObject result = angara_list_new_with_capacity(pieces);
+
+    // 2. Cut the text at each separator.
+    size_t start = 0;
+    for (size_t i = 1; i < pieces; i++) {
+        size_t found = start + kernels()->find(text + start, length - start, separator, separator_length);
+        push_piece(result, args[0], start, found - start);
+        start = found + separator_length;
+    }
+    push_piece(result, args[0], start, length - start);
+    return result;
+}
+
+// Splits `text` into lines, accepting both "\n" and "\r\n" endings. A final
+// line ending does not start another, empty line.
+AngaraObject Angara_adv_string_split_lines(int arg_count, AngaraObject* args) {
+    if (arg_count != 1 || !IS_STRING(args[0])) {
+        angara_throw_error("split_lines(text) expects a string.");
+        return angara_create_nil();
+    }
+    const char* text = AS_STRING_CHARS(args[0]);
+    size_t length = AS_STRING_LENGTH(args[0]);
+
+    // 1. Count the line breaks so the list is allocated once.
+    size_t breaks = kernels()->count_byte(text, length, '\n');
+    bool open_last_line = length > 0 && text[length - 1] != '\n';
+    AngaraObject result = angara_list_new_with_capacity(breaks + open_last_line);
+
+    // 2. Cut each line, leaving off its "\n" or "\r\n".
+    size_t start = 0;
+    for (size_t i = 0; i < breaks; i++) {
+        size_t end = start + kernels()->find_byte(text + start, length - start, '\n');
+        size_t line_end = (end > start && text[end - 1] == '\r') ? end - 1 : end;
+        push_piece(result, args[0], start, line_end - start);
+        start = end + 1;
+    }
+    if (open_last_line) push_piece(result, args[0], start, length - start);
+    return result;
+}
+
+// Replaces every non-overlapping occurrence of `from` with `to`.
+// Angara signature: func replace(text as string, from as string, to as string) -> string
+AngaraObject Angara_adv_string_replace(int arg_count, AngaraObject* args) {
+    if (arg_count != 3 || !IS_STRING(args[0]) || !IS_STRING(args[1]) || !IS_STRING(args[2])) {
+        angara_throw_error("replace(text, from, to) expects three strings.");
+        return angara_create_nil();
+    }
+    const char* text = AS_STRING_CHARS(args[0]);
+    size_t length = AS_STRING_LENGTH(args[0]);
+    const char* from = AS_STRING_CHARS(args[1]);
+    size_t from_length = AS_STRING_LENGTH(args[1]);
+    const char* to = AS_STRING_CHARS(args[2]);
+    size_t to_length = AS_STRING_LENGTH(args[2]);
+
+    // 1. Nothing to replace gives back the same string.
+    size_t matches = from_length == 0 ? 0 : count_occurrences(text, length, from, from_length);
+    if (matches == 0) {
+        angara_incref(args[0]);
+        return args[0];
+    }
+
+    // 2. Allocate the result at its final size.
+    size_t result_length = length - matches * from_length + matches * to_length;
+    char* result_buf = (char*)malloc(result_length + 1);
+    if (!result_buf) {
+        angara_throw_error("Out of memory in replace().");
+        return angara_create_nil();
+    }
+
+    // 3. Copy the text between matches, and `to` in place of each match.
+    char* out = result_buf;
+    size_t start = 0;
+    for (size_t i = 0; i < matches; i++) {
+        size_t found = start + kernels()->find(text + start, length - start, from, from_length);
+        memcpy(out, text + start, found - start);
+        out += found - start;
+        memcpy(out, to, to_length);
+        out += to_length;
+        start = found + from_length;
+    }
+    memcpy(out, text + start, length - start);
+    result_buf[result_length] = '\0';
+    return angara_create_string_no_copy(result_buf, result_length);
+}
+
+// Joins a list of strings with `separator` between them.
+// Angara signature: func join(parts as list<string>, separator as string) -> string
+AngaraObject Angara_adv_string_join(int arg_count, AngaraObject* args) {
+    if (arg_count != 2 || !IS_LIST(args[0]) || !IS_STRING(args[1])) {
+        angara_throw_error("join(parts, separator) expects a list of strings and a string.");
+        return angara_create_nil();
+    }
+    AngaraList* parts = AS_LIST(args[0]);
+    const char* separator = AS_STRING_CHARS(args[1]);
+    size_t separator_length = AS_STRING_LENGTH(args[1]);
+    if (parts->count == 0) return angara_create_string_with_len("", 0);
+    if (parts->kind != ANGARA_LIST_BOXED) {
+        angara_throw_error("join() expects a list of strings.");
+        return angara_create_nil();
+    }
+
+    // 1. Measure the result, checking every element on the way.
+    size_t result_length = separator_length * (parts->count - 1);
+    for (size_t i = 0; i < parts->count; i++) {
+        if (!IS_STRING(parts->elements[i])) {
+            angara_throw_error("join() expects a list of strings.");
+            return angara_create_nil();
+        }
+        result_length += AS_STRING_LENGTH(parts->elements[i]);
+    }
+
+    // 2. Copy the parts and separators into a buffer of exactly that size.
+    char* result_buf = (char*)malloc(result_length + 1);
+    if (!result_buf) {
+        angara_throw_error("Out of memory in join().");
+        return angara_create_nil();
+    }
+    char* out = result_buf;
+    for (size_t i = 0; i < parts->count; i++) {
+        if (i > 0) {
+            memcpy(out, separator, separator_length);
+            out += separator_length;
+        }
+        size_t part_length = AS_STRING_LENGTH(parts->elements[i]);
+        memcpy(out, AS_STRING_CHARS(parts->elements[i]), part_length);
+        out += part_length;
+    }
+    result_buf[result_length] = '\0';
+    return angara_create_string_no_copy(result_buf, result_length);
+}
+
+// Strips leading and trailing whitespace.
+AngaraObject Angara_adv_string_trim(int arg_count, AngaraObject* args) {
+    if (arg_count != 1 || !IS_STRING(args[0])) {
+        angara_throw_error("trim(text) expects a string.");
+        return angara_create_nil();
+    }
+    const char* text = AS_STRING_CHARS(args[0]);
+    size_t start = 0;
+    size_t end = AS_STRING_LENGTH(args[0]);
+    while (start < end && isspace((unsigned char)text[start])) start++;
+    while (end > start && isspace((unsigned char)text[end - 1])) end--;
+    return angara_string_slice(args[0], start, end - start);
+}
+
+
 
 // --- Module Definition ---
 
@@ -138,6 +552,17 @@ static const AngaraFuncDef STRING_EXPORTS[] = {
         {"is_digit",      Angara_adv_string_is_digit,      "s->b",   NULL},
         {"is_whitespace", Angara_adv_string_is_whitespace, "s->b",   NULL},
         {"pad_end",         Angara_adv_string_pad_end,     "sis->s", NULL},
+        {"find",          Angara_adv_string_find,          "ss->i",  NULL},
+        {"find_from",     Angara_adv_string_find_from,     "ssi->i", NULL},
+        {"rfind",         Angara_adv_string_rfind,         "ss->i",  NULL},
+        {"count",         Angara_adv_string_count,         "ss->i",  NULL},
+        {"starts_with",   Angara_adv_string_starts_with,   "ss->b",  NULL},
+        {"ends_with",     Angara_adv_string_ends_with,     "ss->b",  NULL},
+        {"split",         Angara_adv_string_split,         "ss->l<s>", NULL},
+        {"split_lines",   Angara_adv_string_split_lines,   "s->l<s>",  NULL},
+        {"replace",       Angara_adv_string_replace,       "sss->s", NULL},
+        {"join",          Angara_adv_string_join,          "l<s>s->s", NULL},
+        {"trim",          Angara_adv_string_trim,          "s->s",   NULL},
         {NULL, NULL, NULL, NULL}
 };
 
@@ -62,7 +62,7 @@ AngaraObject Angara_fs_write_file(int arg_count, AngaraObject* args) {
     }
     const char* path = AS_CSTRING(args[0]);
     const char* content = AS_CSTRING(args[1]);
-    size_t content_len = ((AngaraString*)args[1].as.obj)->length;
+    size_t content_len = ((AngaraString*)AS_OBJ(args[1]))->length;
 
     FILE* file = fopen(path, "wb");
     if (!file) {
@@ -0,0 +1,36 @@
+#include "../runtime/angara_runtime.h"
+
+// `gc.collect() -> i64`
+// Runs the cycle collector on the calling thread now and returns how many
+// objects it freed.
+AngaraObject Angara_gc_collect(int arg_count, AngaraObject* args) {
+    return angara_create_i64(angara_gc_collect());
+}
+
+// `gc.stats() -> {}`
+// The calling thread's collector statistics. Pause times are in seconds.
+AngaraObject Angara_gc_stats(int arg_count, AngaraObject* args) {
+    AngaraGCStats stats = angara_gc_stats();
+    AngaraObject record = angara_record_new();
+    angara_record_set(record, "collections", angara_create_i64(stats.collections));
+    angara_record_set(record, "reclaimed", angara_create_i64(stats.reclaimed));
+    angara_record_set(record, "last_reclaimed", angara_create_i64(stats.last_reclaimed));
+    angara_record_set(record, "pause_total", angara_create_f64(stats.pause_total));
+    angara_record_set(record, "pause_last", angara_create_f64(stats.pause_last));
+    angara_record_set(record, "pause_max", angara_create_f64(stats.pause_max));
+    return record;
+}
+
+
+// --- ABI Definition ---
+
+static const AngaraFuncDef GC_EXPORTS[] = {
+        { "collect", Angara_gc_collect, "->i",  NULL },
+        { "stats",   Angara_gc_stats,   "->{}", NULL },
+        { NULL, NULL, NULL, NULL }
+};
+
+ANGARA_MODULE_INIT(gc) {
+        *def_count = (sizeof(GC_EXPORTS) / sizeof(AngaraFuncDef)) - 1;
+        return GC_EXPORTS;
+}
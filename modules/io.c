@@ -17,7 +17,6 @@ AngaraObject Angara_io_write(int arg_count, AngaraObject* args) {
     }
 
     int64_t stream_id = AS_I64(args[0]);
-    const char* content = AS_CSTRING(args[1]);
 
     FILE* stream = NULL;
     if (stream_id == 1) {
@@ -29,7 +28,7 @@ AngaraObject Angara_io_write(int arg_count, AngaraObject* args) {
         return angara_create_nil();
     }
 
-    fprintf(stream, "%s", content);
+    fwrite(AS_STRING_CHARS(args[1]), 1, AS_STRING_LENGTH(args[1]), stream);
     return angara_create_nil();
 }
 
@@ -40,7 +39,6 @@ AngaraObject Angara_io_println(int arg_count, AngaraObject* args) {
     }
 
     int64_t stream_id = AS_I64(args[0]);
-    const char* content = AS_CSTRING(args[1]);
 
     FILE* stream = NULL;
     if (stream_id == 1) {
@@ -52,8 +50,8 @@ AngaraObject Angara_io_println(int arg_count, AngaraObject* args) {
         return angara_create_nil();
     }
 
-    // Use puts, which is efficient and automatically adds a newline.
-    fputs(content, stream);
+    // Written by length, so a slice prints without being copied.
+    fwrite(AS_STRING_CHARS(args[1]), 1, AS_STRING_LENGTH(args[1]), stream);
     fputc('\n', stream);
 
     return angara_create_nil();
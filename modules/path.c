@@ -26,7 +26,7 @@ AngaraObject Angara_path_join(int arg_count, AngaraObject* args) {
             angara_throw_error("all arguments to path.join() must be strings.");
             return angara_create_nil();
         }
-        total_len += ((AngaraString*)args[i].as.obj)->length;
+        total_len += ((AngaraString*)AS_OBJ(args[i]))->length;
     }
     // Add space for separators and the null terminator.
     total_len += (arg_count - 1) + 1;
@@ -42,7 +42,7 @@ AngaraObject Angara_path_join(int arg_count, AngaraObject* args) {
     char* current_pos = result_buf;
     for (int i = 0; i < arg_count; i++) {
         const char* part = AS_CSTRING(args[i]);
-        size_t part_len = ((AngaraString*)args[i].as.obj)->length;
+        size_t part_len = ((AngaraString*)AS_OBJ(args[i]))->length;
 
         // Don't prepend a separator for the very first part.
         if (i > 0) {
@@ -0,0 +1,408 @@
+#ifndef ANGARA_INLINE_H
+#define ANGARA_INLINE_H
+
+#include "angara_runtime.h"
+
+/*
+===========================================================================
+ Angara Inline Fast Paths
+---------------------------------------------------------------------------
+ The tiny, hot runtime operations (value constructors, reference counting,
+ truthiness, equality, list access) as `static inline` definitions.
+
+ Generated modules include this header instead of angara_runtime.h, so the
+ C compiler can inline, constant-fold and vectorize across the runtime
+ boundary. Calls to the public names are redirected to the inline bodies
+ by the macros at the end of this file.
+
+ The runtime defines ANGARA_RUNTIME_IMPLEMENTATION and builds its exported
+ symbols on top of these same bodies, so native modules keep linking
+ against the ABI-stable functions declared in angara_runtime.h.
+===========================================================================
+*/
+
+#if defined(__GNUC__) || defined(__clang__)
+#define ANGARA_LIKELY(x)   __builtin_expect(!!(x), 1)
+#define ANGARA_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#else
+#define ANGARA_LIKELY(x)   (x)
+#define ANGARA_UNLIKELY(x) (x)
+#endif
+
+// --- Out-of-line Slow Paths (implemented in angara_runtime.c) ---
+void angara_free_object(Object* object);
+bool angara_objects_equal(AngaraObject a, AngaraObject b);
+// Returns `value` with a new reference for storing into `container`, after
+// sharing it (shared container) or copying it out of a region (outer container).
+AngaraObject angara_retain_for_store(Object* container, AngaraObject value);
+// Buffers `object` as a possible root of a garbage cycle.
+void angara_gc_possible_root(Object* object);
+
+// --- Value Constructors ---
+static inline AngaraObject angara_fast_create_nil(void) { return ANGARA_NIL_VAL; }
+static inline AngaraObject angara_fast_create_bool(bool value) { return ANGARA_BOOL_VAL(value); }
+static inline AngaraObject angara_fast_create_i64(int64_t value) { return ANGARA_I64_VAL(value); }
+static inline AngaraObject angara_fast_create_f64(double value) { return ANGARA_F64_VAL(value); }
+
+// --- Memory Management ---
+// Biased reference counting: an object owned by one thread is counted with
+// plain loads and stores. Once angara_share() has marked it SHARED, every
+// update is atomic. The flag is set before the object is handed to another
+// thread and never cleared, so the owner can test it without synchronization.
+// IMMORTAL and region-owned objects are never counted at all.
+#define ANGARA_OBJ_UNCOUNTED (ANGARA_OBJ_IMMORTAL | ANGARA_OBJ_REGION)
+
+// The object types that can hold references to each other, and so form cycles.
+#define ANGARA_CYCLIC_TYPES ((1u << OBJ_LIST) | (1u << OBJ_RECORD) | (1u << OBJ_INSTANCE) | \
+                             (1u << OBJ_DATA_INSTANCE) | (1u << OBJ_ENUM_INSTANCE))
+
+static inline void angara_fast_incref(AngaraObject value) {
+    if (IS_OBJ(value)) {
+        Object* object = AS_OBJ(value);
+        if (ANGARA_LIKELY(!(object->flags & (ANGARA_OBJ_SHARED | ANGARA_OBJ_UNCOUNTED)))) {
+            object->ref_count++;
+        } else if (!(object->flags & ANGARA_OBJ_UNCOUNTED)) {
+            __atomic_fetch_add(&object->ref_count, 1, __ATOMIC_RELAXED);
+        }
+    }
+#ifdef ANGARA_NAN_BOXING
+    // A wide i64 cell is counted like a shared object.
+    else if (ANGARA_UNLIKELY(angara_nan_is_wide_i64(value))) {
+        __atomic_fetch_add(&angara_nan_as_wide(value)->obj.ref_count, 1, __ATOMIC_RELAXED);
+    }
+#endif
+}
+
+static inline void angara_fast_decref(AngaraObject value) {
+    if (IS_OBJ(value)) {
+        Object* object = AS_OBJ(value);
+        uint32_t remaining;
+        if (ANGARA_LIKELY(!(object->flags & (ANGARA_OBJ_SHARED | ANGARA_OBJ_UNCOUNTED)))) {
+            remaining = --object->ref_count;
+#ifndef ANGARA_NO_CYCLE_COLLECTOR
+            // A container that survives a decrement may be the last way into a cycle.
+            if (remaining != 0 && (ANGARA_CYCLIC_TYPES & (1u << object->type)) &&
+                !(object->flags & ANGARA_OBJ_MARKED)) {
+                angara_gc_possible_root(object);
+                return;
+            }
+#endif
+        } else if (object->flags & ANGARA_OBJ_UNCOUNTED) {
+            return;
+        } else {
+            // Release our writes to the object; the thread dropping the last
+            // reference acquires everyone else's before freeing it.
+            remaining = __atomic_sub_fetch(&object->ref_count, 1, __ATOMIC_ACQ_REL);
+        }
+        if (ANGARA_UNLIKELY(remaining == 0)) angara_free_object(object);
+    }
+#ifdef ANGARA_NAN_BOXING
+    else if (ANGARA_UNLIKELY(angara_nan_is_wide_i64(value))) {
+        Object* cell = &angara_nan_as_wide(value)->obj;
+        if (__atomic_sub_fetch(&cell->ref_count, 1, __ATOMIC_ACQ_REL) == 0) angara_free_object(cell);
+    }
+#endif
+}
+
+static inline AngaraObject angara_fast_retain(AngaraObject value) {
+    angara_fast_incref(value);
+    return value;
+}
+
+// Reads the i64 out of a boxed number the caller owns, and drops it.
+static inline int64_t angara_take_i64(AngaraObject value) {
+    int64_t result = AS_I64(value);
+    angara_fast_decref(value);
+    return result;
+}
+
+// Shared, immortal and region objects may have references that are not
+// counted (or counted by other threads), so they are never unique.
+static inline bool angara_fast_is_unique(AngaraObject value) {
+    if (!IS_OBJ(value)) return false;
+    Object* object = AS_OBJ(value);
+    return !(object->flags & (ANGARA_OBJ_SHARED | ANGARA_OBJ_UNCOUNTED)) && object->ref_count == 1;
+}
+
+// --- Exceptions ---
+// True while a throw is on its way to a `catch` (see ANGARA_EXCEPTION_RETURNS).
+static inline bool angara_exception_pending(void) {
+    return ANGARA_UNLIKELY(!IS_NIL(g_current_exception));
+}
+
+// True if the store angara_retain_for_store() just prepared threw instead. Only
+// exception returns come back from the throw, so only they have to check.
+static inline bool angara_store_failed(void) {
+#ifdef ANGARA_EXCEPTION_RETURNS
+    return angara_exception_pending();
+#else
+    return false;
+#endif
+}
+
+#ifndef ANGARA_EXCEPTION_RETURNS
+static inline void angara_push_local(AngaraObject* slot) {
+    if (ANGARA_UNLIKELY(g_owned_locals.count == g_owned_locals.capacity)) angara_grow_owned_locals();
+    g_owned_locals.slots[g_owned_locals.count++] = slot;
+}
+
+static inline void angara_pop_locals(size_t count) {
+    g_owned_locals.count -= count;
+}
+#endif
+
+// --- Truthiness & Equality ---
+static inline bool angara_fast_is_truthy(AngaraObject value) {
+    switch (VALUE_TYPE(value)) {
+        case VAL_NIL:  return false;
+        case VAL_BOOL: return AS_BOOL(value);
+        case VAL_I64:  return AS_I64(value) != 0;
+        case VAL_F64:  return AS_F64(value) != 0.0;
+        case VAL_OBJ:
+            // Strings, lists and records are falsy when empty.
+            switch (OBJ_TYPE(value)) {
+                case OBJ_STRING: return AS_STRING(value)->length > 0;
+                case OBJ_LIST:   return AS_LIST(value)->count > 0;
+                case OBJ_RECORD: return AS_RECORD(value)->count > 0;
+                // All other object types (functions, instances, threads, etc.) are always truthy.
+                default:         return true;
+            }
+    }
+    return false; // Should be unreachable
+}
+
+static inline bool angara_fast_values_equal(AngaraObject a, AngaraObject b) {
+#ifdef ANGARA_NAN_BOXING
+    // Identical words are equal values, except for NaN.
+    if (a.bits == b.bits) return !IS_F64(a) || AS_F64(a) == AS_F64(a);
+#endif
+    if (VALUE_TYPE(a) != VALUE_TYPE(b)) {
+        // Special case: allow comparing any number to any other number.
+        if ((IS_I64(a) || IS_F64(a)) && (IS_I64(b) || IS_F64(b))) {
+            double x = IS_I64(a) ? (double)AS_I64(a) : AS_F64(a);
+            double y = IS_I64(b) ? (double)AS_I64(b) : AS_F64(b);
+            return x == y;
+        }
+        return false; // Different types are not equal
+    }
+
+    switch (VALUE_TYPE(a)) {
+        case VAL_NIL:  return true;
+        case VAL_BOOL: return AS_BOOL(a) == AS_BOOL(b);
+        case VAL_I64:  return AS_I64(a) == AS_I64(b);
+        case VAL_F64:  return AS_F64(a) == AS_F64(b);
+        case VAL_OBJ:
+            // Identity is always equality; anything else needs the full comparison.
+            return AS_OBJ(a) == AS_OBJ(b) || angara_objects_equal(a, b);
+    }
+    return false;
+}
+
+static inline AngaraObject angara_fast_equals(AngaraObject a, AngaraObject b) {
+    return angara_fast_create_bool(angara_fast_values_equal(a, b));
+}
+
+// --- Collections ---
+static inline AngaraObject angara_fast_len(AngaraObject collection) {
+    if (IS_OBJ(collection)) {
+        if (OBJ_TYPE(collection) == OBJ_STRING) return angara_fast_create_i64((int64_t)AS_STRING(collection)->length);
+        if (OBJ_TYPE(collection) == OBJ_LIST) return angara_fast_create_i64((int64_t)AS_LIST(collection)->count);
+        if (OBJ_TYPE(collection) == OBJ_STRING_BUILDER) {
+            return angara_fast_create_i64((int64_t)AS_STRING_BUILDER(collection)->length);
+        }
+    }
+    return angara_fast_create_nil();
+}
+
+// The index after `index` in a range counting from it towards `end`, or `end` once
+// `step` would reach or pass it, so that stepping never overflows. `index` must
+// still be inside the range; the distances are taken unsigned, where they fit.
+static inline int64_t angara_range_advance(int64_t index, int64_t end, int64_t step) {
+    uint64_t remaining = step > 0 ? (uint64_t)end - (uint64_t)index : (uint64_t)index - (uint64_t)end;
+    uint64_t distance = step > 0 ? (uint64_t)step : 0 - (uint64_t)step;
+    return remaining > distance ? index + step : end;
+}
+
+// --- List Access ---
+// The element at `index` as a boxed value, without taking a reference to it.
+// A packed element is boxed afresh; under NaN-boxing a wide i64 box is then a
+// reference of its own, which the caller drops once it is done with it.
+static inline AngaraObject angara_fast_list_element(const AngaraList* list, size_t index) {
+    switch (list->kind) {
+        case ANGARA_LIST_I64:  return angara_fast_create_i64(list->i64s[index]);
+        case ANGARA_LIST_F64:  return angara_fast_create_f64(list->f64s[index]);
+        case ANGARA_LIST_BOOL: return angara_fast_create_bool(list->bools[index]);
+        default:               return list->elements[index];
+    }
+}
+
+// Unchecked element reads for generated loops, which keep `index` below the count.
+static inline int64_t angara_list_i64_at(const AngaraList* list, size_t index) {
+    return ANGARA_LIKELY(list->kind == ANGARA_LIST_I64) ? list->i64s[index] : AS_I64(list->elements[index]);
+}
+
+static inline double angara_list_f64_at(const AngaraList* list, size_t index) {
+    return ANGARA_LIKELY(list->kind == ANGARA_LIST_F64) ? list->f64s[index] : AS_F64(list->elements[index]);
+}
+
+static inline bool angara_list_bool_at(const AngaraList* list, size_t index) {
+    return ANGARA_LIKELY(list->kind == ANGARA_LIST_BOOL) ? list->bools[index] : AS_BOOL(list->elements[index]);
+}
+
+static inline AngaraObject angara_fast_list_get(AngaraObject list_obj, AngaraObject index_obj) {
+    AngaraList* list = AS_LIST(list_obj);
+    int64_t index = AS_I64(index_obj);
+    if (ANGARA_UNLIKELY(index < 0 || (size_t)index >= list->count)) return angara_fast_create_nil();
+    AngaraObject value = angara_fast_list_element(list, (size_t)index);
+    if (ANGARA_LIKELY(list->kind == ANGARA_LIST_BOXED)) angara_fast_incref(value);
+    return value;
+}
+
+static inline void angara_fast_list_set(AngaraObject list_obj, AngaraObject index_obj, AngaraObject value) {
+    AngaraList* list = AS_LIST(list_obj);
+    int64_t index = AS_I64(index_obj);
+    if (ANGARA_UNLIKELY(index < 0 || (size_t)index >= list->count)) return;
+    switch (list->kind) {
+        case ANGARA_LIST_I64:
+            if (IS_I64(value)) { list->i64s[index] = AS_I64(value); return; }
+            break;
+        case ANGARA_LIST_F64:
+            if (IS_F64(value)) { list->f64s[index] = AS_F64(value); return; }
+            break;
+        case ANGARA_LIST_BOOL:
+            if (IS_BOOL(value)) { list->bools[index] = AS_BOOL(value); return; }
+            break;
+        default:
+            break;
+    }
+    if (ANGARA_UNLIKELY(list->kind != ANGARA_LIST_BOXED)) angara_list_unpack(list);
+    // Take the new reference before dropping the old one, in case they alias.
+    // Shared containers and region values need more than a plain store.
+    if (ANGARA_UNLIKELY(IS_OBJ(value) &&
+                        ((list->obj.flags | AS_OBJ(value)->flags) & (ANGARA_OBJ_SHARED | ANGARA_OBJ_REGION)))) {
+        value = angara_retain_for_store(&list->obj, value);
+        if (angara_store_failed()) return;
+    } else {
+        angara_fast_incref(value);
+    }
+    angara_fast_decref(list->elements[index]);
+    list->elements[index] = value;
+}
+
+// Typed accessors: a packed list of the matching kind is read and written in place.
+static inline int64_t angara_fast_list_get_i64(AngaraObject list_obj, int64_t index) {
+    AngaraList* list = AS_LIST(list_obj);
+    if (ANGARA_UNLIKELY(index < 0 || (size_t)index >= list->count)) return 0;
+    return angara_list_i64_at(list, (size_t)index);
+}
+
+static inline double angara_fast_list_get_f64(AngaraObject list_obj, int64_t index) {
+    AngaraList* list = AS_LIST(list_obj);
+    if (ANGARA_UNLIKELY(index < 0 || (size_t)index >= list->count)) return 0.0;
+    return angara_list_f64_at(list, (size_t)index);
+}
+
+static inline bool angara_fast_list_get_bool(AngaraObject list_obj, int64_t index) {
+    AngaraList* list = AS_LIST(list_obj);
+    if (ANGARA_UNLIKELY(index < 0 || (size_t)index >= list->count)) return false;
+    return angara_list_bool_at(list, (size_t)index);
+}
+
+static inline void angara_fast_list_set_i64(AngaraObject list_obj, int64_t index, int64_t value) {
+    AngaraList* list = AS_LIST(list_obj);
+    if (ANGARA_LIKELY(list->kind == ANGARA_LIST_I64 && index >= 0 && (size_t)index < list->count)) {
+        list->i64s[index] = value;
+        return;
+    }
+    angara_fast_list_set(list_obj, angara_fast_create_i64(index), angara_fast_create_i64(value));
+}
+
+static inline void angara_fast_list_set_f64(AngaraObject list_obj, int64_t index, double value) {
+    AngaraList* list = AS_LIST(list_obj);
+    if (ANGARA_LIKELY(list->kind == ANGARA_LIST_F64 && index >= 0 && (size_t)index < list->count)) {
+        list->f64s[index] = value;
+        return;
+    }
+    angara_fast_list_set(list_obj, angara_fast_create_i64(index), angara_fast_create_f64(value));
+}
+
+static inline void angara_fast_list_set_bool(AngaraObject list_obj, int64_t index, bool value) {
+    AngaraList* list = AS_LIST(list_obj);
+    if (ANGARA_LIKELY(list->kind == ANGARA_LIST_BOOL && index >= 0 && (size_t)index < list->count)) {
+        list->bools[index] = value;
+        return;
+    }
+    angara_fast_list_set(list_obj, angara_fast_create_i64(index), angara_fast_create_bool(value));
+}
+
+static inline void angara_fast_list_push_i64(AngaraObject list_obj, int64_t value) {
+    AngaraList* list = AS_LIST(list_obj);
+    if (ANGARA_LIKELY(list->kind == ANGARA_LIST_I64 && list->count < list->capacity)) {
+        list->i64s[list->count++] = value;
+        list->mod_stamp++;
+        return;
+    }
+    angara_list_push(list_obj, angara_fast_create_i64(value));
+}
+
+static inline void angara_fast_list_push_f64(AngaraObject list_obj, double value) {
+    AngaraList* list = AS_LIST(list_obj);
+    if (ANGARA_LIKELY(list->kind == ANGARA_LIST_F64 && list->count < list->capacity)) {
+        list->f64s[list->count++] = value;
+        list->mod_stamp++;
+        return;
+    }
+    angara_list_push(list_obj, angara_fast_create_f64(value));
+}
+
+static inline void angara_fast_list_push_bool(AngaraObject list_obj, bool value) {
+    AngaraList* list = AS_LIST(list_obj);
+    if (ANGARA_LIKELY(list->kind == ANGARA_LIST_BOOL && list->count < list->capacity)) {
+        list->bools[list->count++] = value;
+        list->mod_stamp++;
+        return;
+    }
+    angara_list_push(list_obj, angara_fast_create_bool(value));
+}
+
+// --- Instance Fields ---
+// Takes over the caller's reference to `value` and returns the reference to
+// store into a field of `owner`: copied out of a region the owner outlives,
+// and shared if the owner is, exactly as for list elements and record values.
+static inline AngaraObject angara_field_store_value(AngaraObject owner, AngaraObject value) {
+    if (ANGARA_UNLIKELY(IS_OBJ(value) &&
+                        ((AS_OBJ(owner)->flags | AS_OBJ(value)->flags) & (ANGARA_OBJ_SHARED | ANGARA_OBJ_REGION)))) {
+        AngaraObject stored = angara_retain_for_store(AS_OBJ(owner), value);
+        angara_fast_decref(value);
+        return stored;
+    }
+    return value;
+}
+
+// --- Redirect the public names to the inline bodies for generated code ---
+#ifndef ANGARA_RUNTIME_IMPLEMENTATION
+#define angara_create_nil()            angara_fast_create_nil()
+#define angara_create_bool(value)      angara_fast_create_bool(value)
+#define angara_create_i64(value)       angara_fast_create_i64(value)
+#define angara_create_f64(value)       angara_fast_create_f64(value)
+#define angara_incref(value)           angara_fast_incref(value)
+#define angara_decref(value)           angara_fast_decref(value)
+#define angara_retain(value)           angara_fast_retain(value)
+#define angara_is_unique(value)        angara_fast_is_unique(value)
+#define angara_is_truthy(value)        angara_fast_is_truthy(value)
+#define angara_equals(a, b)            angara_fast_equals(a, b)
+#define angara_len(collection)         angara_fast_len(collection)
+#define angara_list_get(list, index)   angara_fast_list_get(list, index)
+#define angara_list_set(list, index, value) angara_fast_list_set(list, index, value)
+#define angara_list_get_i64(list, index)  angara_fast_list_get_i64(list, index)
+#define angara_list_get_f64(list, index)  angara_fast_list_get_f64(list, index)
+#define angara_list_get_bool(list, index) angara_fast_list_get_bool(list, index)
+#define angara_list_set_i64(list, index, value)  angara_fast_list_set_i64(list, index, value)
+#define angara_list_set_f64(list, index, value)  angara_fast_list_set_f64(list, index, value)
+#define angara_list_set_bool(list, index, value) angara_fast_list_set_bool(list, index, value)
+#define angara_list_push_i64(list, value)  angara_fast_list_push_i64(list, value)
+#define angara_list_push_f64(list, value)  angara_fast_list_push_f64(list, value)
+#define angara_list_push_bool(list, value) angara_fast_list_push_bool(list, value)
+#endif
+
+#endif //ANGARA_INLINE_H
@@ -2,11 +2,32 @@
 // Created by cv2 on 02.09.2025.
 //
 
-#include "angara_runtime.h"
+// The exported hot-path functions are thin wrappers around the inline bodies.
+#define ANGARA_RUNTIME_IMPLEMENTATION
+#include "angara_inline.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <time.h>
+#include <sched.h>
+#include <unistd.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#if defined(__SANITIZE_ADDRESS__)
+#define ANGARA_ASAN 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define ANGARA_ASAN 1
+#endif
+#endif
+#if ANGARA_ASAN
+#include <sanitizer/asan_interface.h>
+#endif
 
 #define ANSI_COLOR_BOLD_RED   "\033[1;31m"
 #define ANSI_COLOR_YELLOW     "\033[0;33m"
@@ -20,22 +41,358 @@ void printObject(AngaraObject obj);
 // --- Internal Forward Declarations for Records ---
 static void grow_record_capacity(AngaraRecord* record);
 static void free_record(AngaraRecord* record);
+typedef struct RecordKey RecordKey;
+static void record_set_entry(AngaraRecord* record, const RecordKey* key, AngaraObject value);
+
+// --- Internal Forward Declarations for Regions ---
+static bool copy_out_of_region(AngaraObject value, uint32_t depth, AngaraObject* out);
+static AngaraRegion* suspend_regions(void);
+static void resume_regions(AngaraRegion* region);
 
 // --- Value Constructors ---
-AngaraObject angara_create_nil(void) { return (AngaraObject){VAL_NIL, {.i64 = 0}}; }
-AngaraObject angara_create_bool(bool value) { return (AngaraObject){VAL_BOOL, {.boolean = value}}; }
-AngaraObject angara_create_i64(int64_t value) { return (AngaraObject){VAL_I64, {.i64 = value}}; }
-AngaraObject angara_create_f64(double value) { return (AngaraObject){VAL_F64, {.f64 = value}}; }
+AngaraObject angara_create_nil(void) { return angara_fast_create_nil(); }
+AngaraObject angara_create_bool(bool value) { return angara_fast_create_bool(value); }
+AngaraObject angara_create_i64(int64_t value) { return angara_fast_create_i64(value); }
+AngaraObject angara_create_f64(double value) { return angara_fast_create_f64(value); }
+
+#ifdef ANGARA_NAN_BOXING
+AngaraObject angara_box_wide_i64(int64_t value) {
+    // A cell may outlive any region and be counted from any thread.
+    AngaraRegion* region = suspend_regions();
+    AngaraWideInt* cell = (AngaraWideInt*)angara_object_alloc(sizeof(AngaraWideInt), OBJ_WIDE_I64);
+    resume_regions(region);
+    cell->obj.flags |= ANGARA_OBJ_SHARED;
+    cell->value = value;
+    return (AngaraObject){(uint64_t)(uintptr_t)cell | ANGARA_NAN_WIDE_TAG};
+}
+#endif
 
 // --- Memory Management ---
-void angara_incref(AngaraObject value) {
-    if (IS_OBJ(value)) AS_OBJ(value)->ref_count++;
+void angara_incref(AngaraObject value) { angara_fast_incref(value); }
+void angara_decref(AngaraObject value) { angara_fast_decref(value); }
+AngaraObject angara_retain(AngaraObject value) { return angara_fast_retain(value); }
+bool angara_is_unique(AngaraObject value) { return angara_fast_is_unique(value); }
+void angara_free_object(Object* object) { free_object(object); }
+
+// --- Object Allocator ---
+// Objects are carved from 64 KiB slabs in a few size classes that match the
+// object structs. Each thread keeps a free list per class, so allocating and
+// freeing are a couple of pointer moves with no locking. A thread that runs
+// dry takes a batch from the global depot (or a fresh slab); a thread that
+// accumulates too many free blocks returns a batch to the depot. Objects
+// larger than the biggest class go straight to malloc.
+#define SLAB_SIZE (64 * 1024)
+#define CACHE_BATCH 32
+
+static const size_t g_size_classes[] = { 32, 48, 64, 80, 96, 128, 160, 192, 256 };
+#define SIZE_CLASS_COUNT (sizeof(g_size_classes) / sizeof(g_size_classes[0]))
+#define MAX_CLASS_SIZE 256
+
+// Size class (1-based, 0 = malloc) for every size in steps of 16 bytes.
+static const uint8_t g_class_for_size[MAX_CLASS_SIZE / 16 + 1] = {
+    1, 1, 1, 2, 3, 4, 5, 6, 6, 7, 7, 8, 8, 9, 9, 9, 9
+};
+
+// A free block. The first block of a batch in the depot also links to the
+// next batch and remembers how many blocks it chains.
+typedef struct FreeBlock {
+    struct FreeBlock* next;
+    struct FreeBlock* next_batch;
+    size_t batch_count;
+} FreeBlock;
+
+typedef struct {
+    FreeBlock* head;
+    size_t count;
+} ThreadCache;
+
+static struct {
+    FreeBlock* batches[SIZE_CLASS_COUNT];
+    pthread_mutex_t lock;
+} g_depot = { {NULL}, PTHREAD_MUTEX_INITIALIZER };
+
+static __thread ThreadCache t_caches[SIZE_CLASS_COUNT];
+static __thread bool t_caches_registered = false;
+static pthread_key_t g_cache_key;
+static pthread_once_t g_cache_key_once = PTHREAD_ONCE_INIT;
+
+// The cycle collector's per-thread state (see "Cycle Collector" below). The
+// allocator starts a collection when the candidate buffer fills up.
+#define GC_INITIAL_THRESHOLD 10000
+#define GC_MAX_THRESHOLD (1u << 20)
+
+typedef struct {
+    Object** items;
+    size_t count;
+    size_t capacity;
+} GCStack;
+
+typedef struct {
+    GCStack roots;       // Candidate roots, each flagged ANGARA_OBJ_MARKED.
+    size_t threshold;    // Buffered roots that trigger a collection.
+    bool collecting;
+    AngaraGCStats stats;
+} GCState;
+
+static __thread GCState t_gc = { {NULL, 0, 0}, GC_INITIAL_THRESHOLD, false, {0} };
+static void release_cycle_roots(void);
+
+// Detaches up to `count` blocks from the cache and pushes them to the depot as one batch.
+// The caller must hold the depot lock.
+static void push_batch_locked(size_t class_index, ThreadCache* cache, size_t count) {
+    FreeBlock* first = cache->head;
+    FreeBlock* last = first;
+    size_t taken = 1;
+    while (taken < count && last->next != NULL) {
+        last = last->next;
+        taken++;
+    }
+    cache->head = last->next;
+    cache->count -= taken;
+    last->next = NULL;
+
+    first->batch_count = taken;
+    first->next_batch = g_depot.batches[class_index];
+    g_depot.batches[class_index] = first;
+}
+
+// Runs when a thread exits: its cached blocks go back to the depot for reuse.
+static void flush_thread_caches(void* unused) {
+    (void)unused;
+    // Cycles the thread leaves behind are collected first, into its caches.
+    release_cycle_roots();
+    free(g_owned_locals.slots);
+    g_owned_locals = (AngaraLocalStack){NULL, 0, 0};
+    pthread_mutex_lock(&g_depot.lock);
+    for (size_t i = 0; i < SIZE_CLASS_COUNT; i++) {
+        while (t_caches[i].head != NULL) push_batch_locked(i, &t_caches[i], CACHE_BATCH);
+    }
+    pthread_mutex_unlock(&g_depot.lock);
 }
-void angara_decref(AngaraObject value) {
-    if (IS_OBJ(value)) {
-        AS_OBJ(value)->ref_count--;
-        if (AS_OBJ(value)->ref_count == 0) free_object(AS_OBJ(value));
+
+static void create_cache_key(void) {
+    pthread_key_create(&g_cache_key, flush_thread_caches);
+}
+
+static void refill_cache(size_t class_index) {
+    ThreadCache* cache = &t_caches[class_index];
+    if (!t_caches_registered) {
+        // Any non-NULL value makes the key's destructor run at thread exit.
+        pthread_once(&g_cache_key_once, create_cache_key);
+        pthread_setspecific(g_cache_key, cache);
+        t_caches_registered = true;
+    }
+
+    pthread_mutex_lock(&g_depot.lock);
+    FreeBlock* batch = g_depot.batches[class_index];
+    if (batch != NULL) {
+        g_depot.batches[class_index] = batch->next_batch;
+        pthread_mutex_unlock(&g_depot.lock);
+        cache->head = batch;
+        cache->count = batch->batch_count;
+        return;
+    }
+    pthread_mutex_unlock(&g_depot.lock);
+
+    // The depot is empty: carve a new slab into blocks for this thread.
+    size_t block_size = g_size_classes[class_index];
+    char* slab = (char*)malloc(SLAB_SIZE);
+    if (slab == NULL) {
+        exit(1); // Handle allocation failure
+    }
+    size_t block_count = SLAB_SIZE / block_size;
+    for (size_t i = 0; i < block_count; i++) {
+        FreeBlock* block = (FreeBlock*)(slab + i * block_size);
+        block->next = (i + 1 < block_count) ? (FreeBlock*)(slab + (i + 1) * block_size) : NULL;
     }
+    cache->head = (FreeBlock*)slab;
+    cache->count = block_count;
+}
+
+// --- Region Allocation ---
+// A region hands out memory by bumping a pointer through 64 KiB chunks. Each
+// allocation is preceded by its size, so the region can walk its objects and
+// release what they own (element arrays, references to heap objects) when it
+// ends. The chunks themselves are freed wholesale.
+#define REGION_CHUNK_SIZE (64 * 1024)
+#define REGION_MAX_DEPTH 255
+
+typedef struct RegionChunk {
+    struct RegionChunk* next;
+    size_t used;
+    size_t capacity;
+    char data[];
+} RegionChunk;
+
+struct AngaraRegion {
+    struct AngaraRegion* parent; // The enclosing region, or NULL.
+    RegionChunk* chunks;         // Most recent first.
+    uint32_t depth;              // 1 for the outermost region.
+};
+
+// The innermost active region of this thread; NULL allocates on the heap.
+static __thread AngaraRegion* t_current_region = NULL;
+
+static Object* region_alloc(AngaraRegion* region, size_t size) {
+    size = (size + 7) & ~(size_t)7;
+    size_t needed = sizeof(size_t) + size;
+    RegionChunk* chunk = region->chunks;
+    if (chunk == NULL || chunk->capacity - chunk->used < needed) {
+        size_t capacity = needed > REGION_CHUNK_SIZE ? needed : REGION_CHUNK_SIZE;
+        chunk = (RegionChunk*)malloc(sizeof(RegionChunk) + capacity);
+        if (chunk == NULL) {
+            exit(1); // Handle allocation failure
+        }
+        chunk->used = 0;
+        chunk->capacity = capacity;
+        chunk->next = region->chunks;
+        region->chunks = chunk;
+    }
+    char* slot = chunk->data + chunk->used;
+    chunk->used += needed;
+    *(size_t*)slot = size;
+    return (Object*)(slot + sizeof(size_t));
+}
+
+// Immortal objects, and objects handed to other threads, must outlive any
+// region, so they are allocated with the thread's regions suspended.
+static AngaraRegion* suspend_regions(void) {
+    AngaraRegion* region = t_current_region;
+    t_current_region = NULL;
+    return region;
+}
+
+static void resume_regions(AngaraRegion* region) {
+    t_current_region = region;
+}
+
+_Static_assert(sizeof(Object) == 8, "the object header must stay 8 bytes");
+
+Object* angara_object_alloc(size_t size, ObjectType type) {
+    if (ANGARA_UNLIKELY(t_current_region != NULL)) {
+        Object* object = region_alloc(t_current_region, size);
+        object->type = type;
+        object->flags = ANGARA_OBJ_REGION;
+        object->size_class = 0;
+        object->region_depth = (uint8_t)t_current_region->depth;
+        object->ref_count = 1;
+        return object;
+    }
+
+    if (ANGARA_UNLIKELY(t_gc.roots.count >= t_gc.threshold) && !t_gc.collecting) angara_gc_collect();
+
+    Object* object;
+    uint32_t size_class = size <= MAX_CLASS_SIZE ? g_class_for_size[(size + 15) / 16] : 0;
+    if (ANGARA_LIKELY(size_class != 0)) {
+        ThreadCache* cache = &t_caches[size_class - 1];
+        if (ANGARA_UNLIKELY(cache->head == NULL)) refill_cache(size_class - 1);
+        FreeBlock* block = cache->head;
+        cache->head = block->next;
+        cache->count--;
+        object = (Object*)block;
+    } else {
+        object = (Object*)malloc(size);
+        if (object == NULL) {
+            exit(1); // Handle allocation failure
+        }
+    }
+    object->type = type;
+    object->flags = 0;
+    object->size_class = (uint8_t)size_class;
+    object->region_depth = 0;
+    object->ref_count = 1;
+    return object;
+}
+
+void angara_object_free(Object* object) {
+    // A buffered cycle candidate stays allocated until the collector drops it
+    // from its buffer; the zero count tells the collector it is dead.
+    if (ANGARA_UNLIKELY(object->flags & ANGARA_OBJ_MARKED)) {
+        object->ref_count = 0;
+        return;
+    }
+    uint32_t size_class = object->size_class;
+    if (ANGARA_UNLIKELY(size_class == 0)) {
+        // Region memory is released with its region, never one object at a time.
+        if (!(object->flags & ANGARA_OBJ_REGION)) free(object);
+        return;
+    }
+    ThreadCache* cache = &t_caches[size_class - 1];
+    FreeBlock* block = (FreeBlock*)object;
+    block->next = cache->head;
+    cache->head = block;
+    cache->count++;
+    if (ANGARA_UNLIKELY(cache->count >= 2 * CACHE_BATCH)) {
+        pthread_mutex_lock(&g_depot.lock);
+        push_batch_locked(size_class - 1, cache, CACHE_BATCH);
+        pthread_mutex_unlock(&g_depot.lock);
+    }
+}
+
+static void unbuffer_cycle_root(Object* object);
+static void gc_traverse(Object* object, AngaraVisitFn visit, void* context);
+
+// --- Thread Sharing ---
+static void share_slot(AngaraObject* slot, void* context) {
+    (void)context;
+    angara_share(*slot);
+}
+
+// Marks an object and everything it owns as SHARED, switching their reference
+// counts to atomic updates. An object that is already shared has already had
+// its children marked, which also stops the walk on cycles.
+static void share_object(Object* object) {
+    // Immortal objects are never counted, so they need no marking.
+    if (object->flags & (ANGARA_OBJ_SHARED | ANGARA_OBJ_IMMORTAL)) return;
+    object->flags |= ANGARA_OBJ_SHARED;
+    // Shared objects are not cycle candidates; the sharing thread is the one
+    // whose buffer may hold it.
+    if (object->flags & ANGARA_OBJ_MARKED) unbuffer_cycle_root(object);
+
+    switch (object->type) {
+        // A slice shares its parent's bytes and count; it takes its own copy
+        // before another thread can reach it.
+        case OBJ_STRING:    angara_string_materialize((AngaraString*)object); break;
+        case OBJ_LIST: {
+            AngaraList* list = (AngaraList*)object;
+            // Packed elements are plain values with nothing to share.
+            if (list->kind != ANGARA_LIST_BOXED) break;
+            for (size_t i = 0; i < list->count; i++) angara_share(list->elements[i]);
+            break;
+        }
+        case OBJ_RECORD: {
+            AngaraRecord* record = (AngaraRecord*)object;
+            for (size_t i = 0; i < record->count; i++) angara_share(record->entries[i].value);
+            break;
+        }
+        case OBJ_EXCEPTION: angara_share(((AngaraException*)object)->message); break;
+        case OBJ_THREAD:    angara_share(((AngaraThread*)object)->return_value); break;
+        // Instance fields are walked through the compiler-generated traverse hooks.
+        case OBJ_INSTANCE:
+        case OBJ_DATA_INSTANCE:
+        case OBJ_ENUM_INSTANCE: gc_traverse(object, share_slot, NULL); break;
+        default: break;
+    }
+}
+
+AngaraObject angara_share(AngaraObject value) {
+    if (!IS_OBJ(value)) return value;
+    // A region is private to its thread; the value escapes to the heap first.
+    if (ANGARA_UNLIKELY(AS_OBJ(value)->flags & ANGARA_OBJ_REGION)) {
+        if (!copy_out_of_region(value, 0, &value)) {
+            angara_throw_error("Runtime Error: A value allocated in a region cannot be shared with another thread.");
+            return value;
+        }
+    }
+    share_object(AS_OBJ(value));
+    return value;
+}
+
+// Shares `value` and returns a new reference to it (or to its heap copy).
+static AngaraObject share_reference(AngaraObject value) {
+    AngaraObject shared = angara_share(value);
+    if (!IS_OBJ(shared) || AS_OBJ(shared) == AS_OBJ(value)) angara_incref(shared);
+    return shared;
 }
 
 // --- Built-in Functions ---
@@ -47,75 +404,722 @@ void angara_print(int arg_count, AngaraObject args[]) {
     printf("\n");
 }
 
-AngaraObject angara_len(AngaraObject collection) {
-    if (IS_OBJ(collection)) {
-        if (OBJ_TYPE(collection) == OBJ_STRING) return angara_create_i64(AS_STRING(collection)->length);
-        if (OBJ_TYPE(collection) == OBJ_LIST) return angara_create_i64(AS_LIST(collection)->count);
+AngaraObject angara_len(AngaraObject collection) { return angara_fast_len(collection); }
+
+bool angara_is_truthy(AngaraObject value) { return angara_fast_is_truthy(value); }
+
+// --- Number Formatting and Parsing ---
+// Integers are written two digits at a time from a table of digit pairs. Floats
+// get digits that read back as the same double (Grisu2, from Florian Loitsch's
+// "Printing Floating-Point Numbers Quickly and Accurately with Integers"), laid
+// out like printf's %g but without its six-digit cutoff. Grisu2 always
+// round-trips, but for a small fraction of doubles it emits a digit or so more
+// than the shortest text.
+
+static const char g_digit_pairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const uint64_t g_pow10_u64[20] = {
+    UINT64_C(1), UINT64_C(10), UINT64_C(100), UINT64_C(1000), UINT64_C(10000),
+    UINT64_C(100000), UINT64_C(1000000), UINT64_C(10000000), UINT64_C(100000000),
+    UINT64_C(1000000000), UINT64_C(10000000000), UINT64_C(100000000000),
+    UINT64_C(1000000000000), UINT64_C(10000000000000), UINT64_C(100000000000000),
+    UINT64_C(1000000000000000), UINT64_C(10000000000000000), UINT64_C(100000000000000000),
+    UINT64_C(1000000000000000000), UINT64_C(10000000000000000000),
+};
+
+static int count_digits_u64(uint64_t value) {
+    int digits = 1;
+    while (digits < 20 && value >= g_pow10_u64[digits]) digits++;
+    return digits;
+}
+
+// Writes the decimal digits of `value` backwards, ending just before `end`.
+static void write_digits_u64(uint64_t value, char* end) {
+    while (value >= 100) {
+        const char* pair = &g_digit_pairs[(value % 100) * 2];
+        value /= 100;
+        *--end = pair[1];
+        *--end = pair[0];
     }
-    return angara_create_nil();
+    if (value >= 10) {
+        const char* pair = &g_digit_pairs[value * 2];
+        *--end = pair[1];
+        *--end = pair[0];
+    } else {
+        *--end = (char)('0' + value);
+    }
+}
+
+static size_t i64_text_length(int64_t value) {
+    // The magnitude of INT64_MIN does not fit an int64_t, so it is taken unsigned.
+    uint64_t magnitude = value < 0 ? 0 - (uint64_t)value : (uint64_t)value;
+    return (value < 0 ? 1 : 0) + (size_t)count_digits_u64(magnitude);
+}
+
+size_t angara_format_i64(int64_t value, char* out) {
+    uint64_t magnitude = value < 0 ? 0 - (uint64_t)value : (uint64_t)value;
+    size_t length = i64_text_length(value);
+    if (value < 0) out[0] = '-';
+    write_digits_u64(magnitude, out + length);
+    return length;
+}
+
+// A 64-bit significand and binary exponent: f * 2^e.
+typedef struct {
+    uint64_t f;
+    int e;
+} DiyFp;
+
+// The upper half of the 128-bit product, rounded.
+static DiyFp diyfp_multiply(DiyFp a, DiyFp b) {
+    const uint64_t mask32 = UINT64_C(0xFFFFFFFF);
+    uint64_t a_hi = a.f >> 32, a_lo = a.f & mask32;
+    uint64_t b_hi = b.f >> 32, b_lo = b.f & mask32;
+    uint64_t hh = a_hi * b_hi, hl = a_hi * b_lo, lh = a_lo * b_hi, ll = a_lo * b_lo;
+    uint64_t middle = (ll >> 32) + (hl & mask32) + (lh & mask32) + (UINT64_C(1) << 31);
+    DiyFp product = { hh + (hl >> 32) + (lh >> 32) + (middle >> 32), a.e + b.e + 64 };
+    return product;
+}
+
+// Normalized 10^k for k = -348, -340, ..., 340: 10^k ~= f * 2^e.
+static const uint64_t g_cached_powers_f[87] = {
+    UINT64_C(0xfa8fd5a0081c0288), UINT64_C(0xbaaee17fa23ebf76), UINT64_C(0x8b16fb203055ac76),
+    UINT64_C(0xcf42894a5dce35ea), UINT64_C(0x9a6bb0aa55653b2d), UINT64_C(0xe61acf033d1a45df),
+    UINT64_C(0xab70fe17c79ac6ca), UINT64_C(0xff77b1fcbebcdc4f), UINT64_C(0xbe5691ef416bd60c),
+    UINT64_C(0x8dd01fad907ffc3c), UINT64_C(0xd3515c2831559a83), UINT64_C(0x9d71ac8fada6c9b5),
+    UINT64_C(0xea9c227723ee8bcb), UINT64_C(0xaecc49914078536d), UINT64_C(0x823c12795db6ce57),
+    UINT64_C(0xc21094364dfb5637), UINT64_C(0x9096ea6f3848984f), UINT64_C(0xd77485cb25823ac7),
+    UINT64_C(0xa086cfcd97bf97f4), UINT64_C(0xef340a98172aace5), UINT64_C(0xb23867fb2a35b28e),
+    UINT64_C(0x84c8d4dfd2c63f3b), UINT64_C(0xc5dd44271ad3cdba), UINT64_C(0x936b9fcebb25c996),
+    UINT64_C(0xdbac6c247d62a584), UINT64_C(0xa3ab66580d5fdaf6), UINT64_C(0xf3e2f893dec3f126),
+    UINT64_C(0xb5b5ada8aaff80b8), UINT64_C(0x87625f056c7c4a8b), UINT64_C(0xc9bcff6034c13053),
+    UINT64_C(0x964e858c91ba2655), UINT64_C(0xdff9772470297ebd), UINT64_C(0xa6dfbd9fb8e5b88f),
+    UINT64_C(0xf8a95fcf88747d94), UINT64_C(0xb94470938fa89bcf), UINT64_C(0x8a08f0f8bf0f156b),
+    UINT64_C(0xcdb02555653131b6), UINT64_C(0x993fe2c6d07b7fac), UINT64_C(0xe45c10c42a2b3b06),
+    UINT64_C(0xaa242499697392d3), UINT64_C(0xfd87b5f28300ca0e), UINT64_C(0xbce5086492111aeb),
+    UINT64_C(0x8cbccc096f5088cc), UINT64_C(0xd1b71758e219652c), UINT64_C(0x9c40000000000000),
+    UINT64_C(0xe8d4a51000000000), UINT64_C(0xad78ebc5ac620000), UINT64_C(0x813f3978f8940984),
+    UINT64_C(0xc097ce7bc90715b3), UINT64_C(0x8f7e32ce7bea5c70), UINT64_C(0xd5d238a4abe98068),
+    UINT64_C(0x9f4f2726179a2245), UINT64_C(0xed63a231d4c4fb27), UINT64_C(0xb0de65388cc8ada8),
+    UINT64_C(0x83c7088e1aab65db), UINT64_C(0xc45d1df942711d9a), UINT64_C(0x924d692ca61be758),
+    UINT64_C(0xda01ee641a708dea), UINT64_C(0xa26da3999aef774a), UINT64_C(0xf209787bb47d6b85),
+    UINT64_C(0xb454e4a179dd1877), UINT64_C(0x865b86925b9bc5c2), UINT64_C(0xc83553c5c8965d3d),
+    UINT64_C(0x952ab45cfa97a0b3), UINT64_C(0xde469fbd99a05fe3), UINT64_C(0xa59bc234db398c25),
+    UINT64_C(0xf6c69a72a3989f5c), UINT64_C(0xb7dcbf5354e9bece), UINT64_C(0x88fcf317f22241e2),
+    UINT64_C(0xcc20ce9bd35c78a5), UINT64_C(0x98165af37b2153df), UINT64_C(0xe2a0b5dc971f303a),
+    UINT64_C(0xa8d9d1535ce3b396), UINT64_C(0xfb9b7cd9a4a7443c), UINT64_C(0xbb764c4ca7a44410),
+    UINT64_C(0x8bab8eefb6409c1a), UINT64_C(0xd01fef10a657842c), UINT64_C(0x9b10a4e5e9913129),
+    UINT64_C(0xe7109bfba19c0c9d), UINT64_C(0xac2820d9623bf429), UINT64_C(0x80444b5e7aa7cf85),
+    UINT64_C(0xbf21e44003acdd2d), UINT64_C(0x8e679c2f5e44ff8f), UINT64_C(0xd433179d9c8cb841),
+    UINT64_C(0x9e19db92b4e31ba9), UINT64_C(0xeb96bf6ebadf77d9), UINT64_C(0xaf87023b9bf0ee6b),
+};
+static const int16_t g_cached_powers_e[87] = {
+    -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980,
+    -954, -927, -901, -874, -847, -821, -794, -768, -741, -715,
+    -688, -661, -635, -608, -582, -555, -529, -502, -475, -449,
+    -422, -396, -369, -343, -316, -289, -263, -236, -210, -183,
+    -157, -130, -103, -77, -50, -24, 3, 30, 56, 83,
+    109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+    375, 402, 428, 455, 481, 508, 534, 561, 588, 614,
+    641, 667, 694, 720, 747, 774, 800, 827, 853, 880,
+    907, 933, 960, 986, 1013, 1039, 1066,
+};
+
+#define DOUBLE_HIDDEN_BIT (UINT64_C(1) << 52)
+
+// Steps the last digit down while that keeps it inside the boundaries and brings
+// it closer to the exact value.
+static void grisu_round(char* buffer, int length, uint64_t delta, uint64_t rest, uint64_t ten_kappa, uint64_t wp_w) {
+    while (rest < wp_w && delta - rest >= ten_kappa &&
+           (rest + ten_kappa < wp_w || wp_w - rest > rest + ten_kappa - wp_w)) {
+        buffer[length - 1]--;
+        rest += ten_kappa;
+    }
+}
+
+// Generates the digits of `mp` until they fall within `delta` of it.
+static int grisu_digit_gen(DiyFp w, DiyFp mp, uint64_t delta, char* buffer, int* k) {
+    DiyFp one = { UINT64_C(1) << -mp.e, mp.e };
+    uint64_t wp_w = mp.f - w.f;
+    uint32_t p1 = (uint32_t)(mp.f >> -one.e);
+    uint64_t p2 = mp.f & (one.f - 1);
+    int kappa = count_digits_u64(p1);
+    int length = 0;
+
+    // 1. The integral part.
+    while (kappa > 0) {
+        uint32_t divisor = (uint32_t)g_pow10_u64[kappa - 1];
+        uint32_t digit = p1 / divisor;
+        p1 %= divisor;
+        if (digit != 0 || length != 0) buffer[length++] = (char)('0' + digit);
+        kappa--;
+        uint64_t rest = ((uint64_t)p1 << -one.e) + p2;
+        if (rest <= delta) {
+            *k += kappa;
+            grisu_round(buffer, length, delta, rest, g_pow10_u64[kappa] << -one.e, wp_w);
+            return length;
+        }
+    }
+
+    // 2. The fractional part.
+    for (;;) {
+        p2 *= 10;
+        delta *= 10;
+        char digit = (char)(p2 >> -one.e);
+        if (digit != 0 || length != 0) buffer[length++] = (char)('0' + digit);
+        p2 &= one.f - 1;
+        kappa--;
+        if (p2 < delta) {
+            *k += kappa;
+            int index = -kappa;
+            grisu_round(buffer, length, delta, p2, one.f, wp_w * (index < 20 ? g_pow10_u64[index] : 0));
+            return length;
+        }
+    }
+}
+
+// The shortest digits of a finite, positive double: value = digits * 10^k.
+static int grisu2(double value, char* buffer, int* k) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    int biased_e = (int)((bits >> 52) & 0x7FF);
+    uint64_t significand = bits & (DOUBLE_HIDDEN_BIT - 1);
+    DiyFp v = biased_e != 0 ? (DiyFp){ significand + DOUBLE_HIDDEN_BIT, biased_e - 1075 }
+                            : (DiyFp){ significand, -1074 };
+
+    // 1. The boundaries halfway to the neighbouring doubles, with a common exponent.
+    DiyFp plus = { (v.f << 1) + 1, v.e - 1 };
+    while (!(plus.f & (DOUBLE_HIDDEN_BIT << 1))) {
+        plus.f <<= 1;
+        plus.e--;
+    }
+    plus.f <<= 10;
+    plus.e -= 10;
+    DiyFp minus = v.f == DOUBLE_HIDDEN_BIT ? (DiyFp){ (v.f << 2) - 1, v.e - 2 } : (DiyFp){ (v.f << 1) - 1, v.e - 1 };
+    minus.f <<= minus.e - plus.e;
+    minus.e = plus.e;
+    while (!(v.f & (UINT64_C(1) << 63))) {
+        v.f <<= 1;
+        v.e--;
+    }
+
+    // 2. Scale by the cached power of ten that brings the exponent into [-60, -32].
+    double dk = (-61 - plus.e) * 0.30102999566398114 + 347;
+    int cached_k = (int)dk;
+    if (dk - cached_k > 0.0) cached_k++;
+    unsigned index = (unsigned)((cached_k >> 3) + 1);
+    *k = -(-348 + (int)(index << 3));
+    DiyFp cached = { g_cached_powers_f[index], g_cached_powers_e[index] };
+
+    DiyFp w = diyfp_multiply(v, cached);
+    DiyFp w_plus = diyfp_multiply(plus, cached);
+    DiyFp w_minus = diyfp_multiply(minus, cached);
+    w_minus.f++;
+    w_plus.f--;
+    return grisu_digit_gen(w, w_plus, w_plus.f - w_minus.f, buffer, k);
 }
 
-bool angara_is_truthy(AngaraObject value) {
-    switch (value.type) {
+// A double as decimal digits: value = 0.d1d2...dn * 10^point. Infinities and
+// NaN carry their text in `special` instead.
+typedef struct {
+    char digits[20];
+    int length;
+    int point;
+    bool negative;
+    const char* special;
+} DecimalF64;
+
+static void decompose_f64(double value, DecimalF64* out) {
+    out->negative = signbit(value) != 0;
+    out->special = NULL;
+    if (isnan(value)) {
+        out->negative = false;
+        out->special = "nan";
+    } else if (isinf(value)) {
+        out->special = out->negative ? "-inf" : "inf";
+    } else if (value == 0.0) {
+        out->digits[0] = '0';
+        out->length = 1;
+        out->point = 1;
+    } else {
+        int k;
+        out->length = grisu2(fabs(value), out->digits, &k);
+        out->point = out->length + k;
+    }
+}
+
+// Plain notation from 1e-4 up to 1e16, like %g's range for 17 digits;
+// scientific (d.ddde+XX) outside it.
+static bool uses_plain_notation(const DecimalF64* decimal) {
+    return decimal->point >= -3 && decimal->point <= 16;
+}
+
+static size_t decimal_text_length(const DecimalF64* decimal) {
+    if (decimal->special) return strlen(decimal->special);
+    size_t length = decimal->negative ? 1 : 0;
+    int n = decimal->length, point = decimal->point;
+    if (uses_plain_notation(decimal)) {
+        if (point >= n) return length + (size_t)point;
+        if (point > 0) return length + (size_t)n + 1;
+        return length + 2 + (size_t)(-point) + (size_t)n;
+    }
+    int exponent = point - 1;
+    int magnitude = exponent < 0 ? -exponent : exponent;
+    return length + (size_t)n + (n > 1 ? 1 : 0) + 2 + (magnitude >= 100 ? 3 : 2);
+}
+
+static size_t write_decimal_text(const DecimalF64* decimal, char* out) {
+    if (decimal->special) {
+        size_t length = strlen(decimal->special);
+        memcpy(out, decimal->special, length);
+        return length;
+    }
+    char* p = out;
+    int n = decimal->length, point = decimal->point;
+    if (decimal->negative) *p++ = '-';
+    if (uses_plain_notation(decimal)) {
+        if (point >= n) {
+            // 1234500: the digits, then zeros up to the decimal point.
+            memcpy(p, decimal->digits, (size_t)n);
+            p += n;
+            memset(p, '0', (size_t)(point - n));
+            p += point - n;
+        } else if (point > 0) {
+            // 12.345
+            memcpy(p, decimal->digits, (size_t)point);
+            p += point;
+            *p++ = '.';
+            memcpy(p, decimal->digits + point, (size_t)(n - point));
+            p += n - point;
+        } else {
+            // 0.0012345
+            *p++ = '0';
+            *p++ = '.';
+            memset(p, '0', (size_t)(-point));
+            p += -point;
+            memcpy(p, decimal->digits, (size_t)n);
+            p += n;
+        }
+        return (size_t)(p - out);
+    }
+
+    // 1.2345e+20 or 5e-07, with at least two exponent digits as printf writes them.
+    *p++ = decimal->digits[0];
+    if (n > 1) {
+        *p++ = '.';
+        memcpy(p, decimal->digits + 1, (size_t)(n - 1));
+        p += n - 1;
+    }
+    int exponent = point - 1;
+    *p++ = 'e';
+    *p++ = exponent < 0 ? '-' : '+';
+    if (exponent < 0) exponent = -exponent;
+    if (exponent >= 100) {
+        *p++ = (char)('0' + exponent / 100);
+        exponent %= 100;
+    }
+    *p++ = g_digit_pairs[exponent * 2];
+    *p++ = g_digit_pairs[exponent * 2 + 1];
+    return (size_t)(p - out);
+}
+
+size_t angara_format_f64(double value, char* out) {
+    DecimalF64 decimal;
+    decompose_f64(value, &decimal);
+    return write_decimal_text(&decimal, out);
+}
+
+// Writes the text of nil, a boolean or a number into `buffer` (at least
+// ANGARA_NUMBER_TEXT_MAX bytes) and returns its length, or -1 for an object.
+// Every conversion to text goes through here, so `string(x)`, interpolation,
+// builders and printing agree.
+static int format_scalar(AngaraObject value, char* buffer) {
+    switch (VALUE_TYPE(value)) {
         case VAL_NIL:
-            return false;
+            memcpy(buffer, "nil", 3);
+            return 3;
         case VAL_BOOL:
-            return AS_BOOL(value);
+            if (AS_BOOL(value)) {
+                memcpy(buffer, "true", 4);
+                return 4;
+            }
+            memcpy(buffer, "false", 5);
+            return 5;
         case VAL_I64:
-            return AS_I64(value) != 0;
+            return (int)angara_format_i64(AS_I64(value), buffer);
         case VAL_F64:
-            return AS_F64(value) != 0.0;
-        case VAL_OBJ: {
-            // For object types, we check if they are "empty".
-            switch (OBJ_TYPE(value)) {
-                case OBJ_STRING:
-                    // An empty string is falsy.
-                    return AS_STRING(value)->length > 0;
-                case OBJ_LIST:
-                    // An empty list is falsy.
-                    return AS_LIST(value)->count > 0;
-                case OBJ_RECORD:
-                    // An empty record is falsy.
-                    return AS_RECORD(value)->count > 0;
+            return (int)angara_format_f64(AS_F64(value), buffer);
+        default:
+            return -1;
+    }
+}
 
-                    // All other object types (functions, instances, threads, etc.) are always truthy.
-                default:
-                    return true;
+static bool is_digit_char(char c) {
+    return c >= '0' && c <= '9';
+}
+
+int64_t angara_parse_i64(const char* text) {
+    // Fast path: an optional sign and up to 18 digits, which cannot overflow.
+    const char* p = text;
+    bool negative = *p == '-';
+    if (*p == '-' || *p == '+') p++;
+    if (is_digit_char(*p)) {
+        uint64_t value = 0;
+        int digits = 0;
+        while (is_digit_char(*p) && digits < 19) {
+            value = value * 10 + (uint64_t)(*p++ - '0');
+            digits++;
+        }
+        if (digits < 19) return negative ? -(int64_t)value : (int64_t)value;
+    }
+    // Leading space, a possible overflow, or no number at all: strtoll's rules.
+    return strtoll(text, NULL, 10);
+}
+
+double angara_parse_f64(const char* text) {
+    // Fast path (Clinger): with at most 19 significant digits that fit in 53 bits
+    // and a power of ten up to 22, both factors are exact doubles and a single
+    // multiplication or division rounds correctly.
+    static const double pow10[23] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+    };
+    const char* p = text;
+    bool negative = *p == '-';
+    if (*p == '-' || *p == '+') p++;
+
+    // 1. The significant digits, and where the decimal point falls among them.
+    uint64_t mantissa = 0;
+    int significant = 0;
+    int exponent = 0;
+    bool any_digit = false;
+    for (; is_digit_char(*p); p++) {
+        any_digit = true;
+        if (mantissa != 0 || *p != '0') {
+            mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+            significant++;
+        }
+        if (significant > 19) return strtod(text, NULL);
+    }
+    if (*p == '.') {
+        for (p++; is_digit_char(*p); p++) {
+            any_digit = true;
+            if (mantissa != 0 || *p != '0') {
+                mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+                significant++;
             }
+            exponent--;
+            if (significant > 19) return strtod(text, NULL);
         }
-        default:
-            return false; // Should be unreachable
     }
+    // No digits (space, "inf", "nan") or a hex float: strtod's rules.
+    if (!any_digit || *p == 'x' || *p == 'X') return strtod(text, NULL);
+
+    // 2. An exponent counts only if digits follow it, as with strtod.
+    if (*p == 'e' || *p == 'E') {
+        const char* q = p + 1;
+        bool exponent_negative = *q == '-';
+        if (*q == '-' || *q == '+') q++;
+        if (is_digit_char(*q)) {
+            int value = 0;
+            for (; is_digit_char(*q); q++) {
+                if (value < 10000) value = value * 10 + (*q - '0');
+            }
+            exponent += exponent_negative ? -value : value;
+        }
+    }
+
+    if (mantissa <= (UINT64_C(1) << 53) && exponent >= -22 && exponent <= 22) {
+        double value = (double)mantissa;
+        value = exponent < 0 ? value / pow10[-exponent] : value * pow10[exponent];
+        return negative ? -value : value;
+    }
+    return strtod(text, NULL);
 }
 
 // --- String Implementation ---
-AngaraObject angara_string_from_c(const char* chars) {
-    size_t length = strlen(chars);
-    AngaraString* string = (AngaraString*)malloc(sizeof(AngaraString));
-    string->obj.type = OBJ_STRING;
-    string->obj.ref_count = 1;
+// Allocates a string of `length` bytes whose characters are stored inline,
+// right after the header, in a single allocation. The caller fills them in.
+static AngaraString* allocate_string(size_t length) {
+    AngaraString* string = (AngaraString*)angara_object_alloc(sizeof(AngaraString) + length + 1, OBJ_STRING);
+    if (string == NULL) return NULL;
     string->length = length;
-    string->chars = (char*)malloc(length + 1);
-    memcpy(string->chars, chars, length);
+    string->chars = string->inline_chars;
     string->chars[length] = '\0';
-    return (AngaraObject){VAL_OBJ, {.obj = (Object*)string}};
+    string->hash = 0;
+    string->is_slice = false;
+    return string;
+}
+
+// The empty string and every one-byte string are preallocated immortals, so
+// character-at-a-time code (indexing, splitting, building) never allocates.
+static AngaraString* g_small_strings[257]; // [0..255] one byte, [256] empty.
+static pthread_once_t g_small_strings_once = PTHREAD_ONCE_INIT;
+
+static void init_small_strings(void) {
+    AngaraRegion* region = suspend_regions();
+    for (int i = 0; i < 257; i++) {
+        AngaraString* string = allocate_string(i < 256 ? 1 : 0);
+        if (i < 256) string->chars[0] = (char)i;
+        string->obj.flags |= ANGARA_OBJ_IMMORTAL;
+        g_small_strings[i] = string;
+    }
+    resume_regions(region);
+}
+
+AngaraObject angara_create_string_with_len(const char* chars, size_t length) {
+    if (length <= 1) {
+        pthread_once(&g_small_strings_once, init_small_strings);
+        return ANGARA_OBJ_VAL(g_small_strings[length == 0 ? 256 : (unsigned char)chars[0]]);
+    }
+    AngaraString* string = allocate_string(length);
+    if (string == NULL) return angara_create_nil();
+    memcpy(string->chars, chars, length);
+    return ANGARA_OBJ_VAL(string);
+}
+
+AngaraObject angara_string_from_c(const char* chars) {
+    return angara_create_string_with_len(chars, strlen(chars));
+}
+
+// --- String Slices ---
+// A slice is a string object whose `chars` point into its parent's bytes. The
+// reference to the parent is kept right after the header, where a plain string
+// keeps its bytes. Slices of slices point at the original parent, never a chain.
+// Shorter substrings are copied: the copy is no bigger than a slice would be,
+// and does not keep a large parent alive.
+#define STRING_SLICE_MIN 16
+
+static AngaraString* slice_parent(const AngaraString* slice) {
+    AngaraString* parent;
+    memcpy(&parent, slice->inline_chars, sizeof(parent));
+    return parent;
+}
+
+// Releases whatever a string's bytes live in, other than the string itself.
+static void release_string_chars(AngaraString* string) {
+    if (string->is_slice) {
+        angara_decref(ANGARA_OBJ_VAL(slice_parent(string)));
+    } else if (string->chars != string->inline_chars) {
+        // An adopted external buffer, or a growable one.
+        free(string->chars);
+    }
+}
+
+AngaraObject angara_string_slice(AngaraObject string_obj, size_t start, size_t length) {
+    AngaraString* source = AS_STRING(string_obj);
+    if (length < STRING_SLICE_MIN) return angara_create_string_with_len(source->chars + start, length);
+    if (start == 0 && length == source->length) {
+        angara_incref(string_obj);
+        return string_obj;
+    }
+
+    AngaraString* parent = source->is_slice ? slice_parent(source) : source;
+    AngaraString* slice = (AngaraString*)angara_object_alloc(sizeof(AngaraString) + sizeof(AngaraString*), OBJ_STRING);
+    if (slice == NULL) return angara_create_nil();
+    slice->length = length;
+    slice->chars = source->chars + start;
+    slice->hash = 0;
+    slice->is_slice = true;
+    angara_incref(ANGARA_OBJ_VAL(parent));
+    memcpy(slice->inline_chars, &parent, sizeof(parent));
+    return ANGARA_OBJ_VAL(slice);
+}
+
+char* angara_string_materialize(AngaraString* string) {
+    if (!string->is_slice) return string->chars;
+    // The slice becomes an ordinary string that owns a buffer, like an adopted one.
+    char* chars = (char*)malloc(string->length + 1);
+    if (chars == NULL) exit(1);
+    memcpy(chars, string->chars, string->length);
+    chars[string->length] = '\0';
+    release_string_chars(string);
+    string->chars = chars;
+    string->is_slice = false;
+    return chars;
+}
+
+// --- String Hashing and Equality ---
+// Mixes the text in eight bytes at a time, then scrambles the result so its low
+// bits (the ones hash tables index with) depend on every byte. Never returns 0,
+// which marks a string whose hash is not cached yet.
+static uint32_t hash_bytes(const char* chars, size_t length) {
+    const uint64_t multiplier = UINT64_C(0xff51afd7ed558ccd);
+    uint64_t hash = UINT64_C(0x9e3779b97f4a7c15) ^ length;
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        uint64_t word;
+        memcpy(&word, chars + i, 8);
+        hash = (hash ^ word) * multiplier;
+        hash ^= hash >> 32;
+    }
+    if (i < length) {
+        uint64_t word = 0;
+        memcpy(&word, chars + i, length - i);
+        hash = (hash ^ word) * multiplier;
+        hash ^= hash >> 32;
+    }
+    hash ^= hash >> 33;
+    hash *= UINT64_C(0xc4ceb9fe1a85ec53);
+    hash ^= hash >> 33;
+    uint32_t result = (uint32_t)hash;
+    return result != 0 ? result : 1;
+}
+
+uint32_t angara_string_hash(AngaraString* string) {
+    // Threads sharing a string may race to fill in the cache; they store the same value.
+    uint32_t hash = __atomic_load_n(&string->hash, __ATOMIC_RELAXED);
+    if (hash == 0) {
+        hash = hash_bytes(string->chars, string->length);
+        __atomic_store_n(&string->hash, hash, __ATOMIC_RELAXED);
+    }
+    return hash;
+}
+
+// Compares `length` bytes. Keys that share a prefix ("user-1041", "user-1042")
+// usually differ near the end, so the last block is checked first. Long strings
+// go 16 bytes at a time; short ones take two overlapping word loads.
+static bool bytes_equal(const char* a, const char* b, size_t length) {
+    if (length >= 16) {
+#if defined(__SSE2__)
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + length - 16));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + length - 16));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) != 0xFFFF) return false;
+        for (size_t i = 0; i + 16 < length; i += 16) {
+            x = _mm_loadu_si128((const __m128i*)(a + i));
+            y = _mm_loadu_si128((const __m128i*)(b + i));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) != 0xFFFF) return false;
+        }
+        return true;
+#elif defined(__aarch64__)
+        uint8x16_t equal = vceqq_u8(vld1q_u8((const uint8_t*)a + length - 16), vld1q_u8((const uint8_t*)b + length - 16));
+        if (vminvq_u8(equal) != 0xFF) return false;
+        for (size_t i = 0; i + 16 < length; i += 16) {
+            equal = vceqq_u8(vld1q_u8((const uint8_t*)a + i), vld1q_u8((const uint8_t*)b + i));
+            if (vminvq_u8(equal) != 0xFF) return false;
+        }
+        return true;
+#else
+        return memcmp(a, b, length) == 0;
+#endif
+    }
+    if (length >= 8) {
+        uint64_t a_head, b_head, a_tail, b_tail;
+        memcpy(&a_tail, a + length - 8, 8);
+        memcpy(&b_tail, b + length - 8, 8);
+        memcpy(&a_head, a, 8);
+        memcpy(&b_head, b, 8);
+        return ((a_tail ^ b_tail) | (a_head ^ b_head)) == 0;
+    }
+    if (length >= 4) {
+        uint32_t a_head, b_head, a_tail, b_tail;
+        memcpy(&a_tail, a + length - 4, 4);
+        memcpy(&b_tail, b + length - 4, 4);
+        memcpy(&a_head, a, 4);
+        memcpy(&b_head, b, 4);
+        return ((a_tail ^ b_tail) | (a_head ^ b_head)) == 0;
+    }
+    for (size_t i = 0; i < length; i++) {
+        if (a[i] != b[i]) return false;
+    }
+    return true;
+}
+
+bool angara_string_equals(AngaraString* a, AngaraString* b) {
+    // 1. Cheap ways to tell them apart: the length, or two hashes already cached.
+    if (a->length != b->length) return false;
+    if (a->chars == b->chars) return true;
+    uint32_t hash_a = __atomic_load_n(&a->hash, __ATOMIC_RELAXED);
+    uint32_t hash_b = __atomic_load_n(&b->hash, __ATOMIC_RELAXED);
+    if (hash_a != hash_b && hash_a != 0 && hash_b != 0) return false;
+    // 2. Two interned copies differ exactly when their pointers do.
+    if ((a->obj.flags & b->obj.flags & ANGARA_OBJ_INTERNED) != 0) return false;
+    // 3. The bytes themselves.
+    return bytes_equal(a->chars, b->chars, a->length);
 }
 
 // --- List Implementation ---
+static size_t list_element_size(AngaraListKind kind) {
+    switch (kind) {
+        case ANGARA_LIST_I64:  return sizeof(int64_t);
+        case ANGARA_LIST_F64:  return sizeof(double);
+        case ANGARA_LIST_BOOL: return sizeof(uint8_t);
+        default:               return sizeof(AngaraObject);
+    }
+}
+
 static void grow_list_capacity(AngaraList* list) {
     size_t old_capacity = list->capacity;
     list->capacity = old_capacity < 8 ? 8 : old_capacity * 2;
-    list->elements = (AngaraObject*)realloc(list->elements, sizeof(AngaraObject) * list->capacity);
+    list->elements = realloc(list->elements, list_element_size(list->kind) * list->capacity);
+}
+
+// Whether `value` can be stored into the list's packed storage as it is.
+static bool fits_list_storage(const AngaraList* list, AngaraObject value) {
+    switch (list->kind) {
+        case ANGARA_LIST_I64:  return IS_I64(value);
+        case ANGARA_LIST_F64:  return IS_F64(value);
+        case ANGARA_LIST_BOOL: return IS_BOOL(value);
+        default:               return true;
+    }
+}
+
+void angara_list_unpack(AngaraList* list) {
+    if (list->kind == ANGARA_LIST_BOXED) return;
+    AngaraObject* elements = NULL;
+    if (list->capacity > 0) {
+        elements = (AngaraObject*)malloc(sizeof(AngaraObject) * list->capacity);
+        if (elements == NULL) exit(1);
+    }
+    for (size_t i = 0; i < list->count; i++) elements[i] = angara_fast_list_element(list, i);
+    free(list->i64s);
+    list->elements = elements;
+    list->kind = ANGARA_LIST_BOXED;
 }
 
 AngaraObject angara_list_new(void) {
-    AngaraList* list = (AngaraList*)malloc(sizeof(AngaraList));
-    list->obj.type = OBJ_LIST;
-    list->obj.ref_count = 1;
+    AngaraList* list = (AngaraList*)angara_object_alloc(sizeof(AngaraList), OBJ_LIST);
     list->count = 0;
     list->capacity = 0;
     list->elements = NULL;
-    return (AngaraObject){VAL_OBJ, {.obj = (Object*)list}};
+    list->mod_stamp = 0;
+    list->kind = ANGARA_LIST_BOXED;
+    return ANGARA_OBJ_VAL(list);
+}
+
+AngaraObject angara_list_new_packed(AngaraListKind kind, size_t count, const void* values) {
+    AngaraObject list_obj = angara_list_new();
+    AngaraList* list = AS_LIST(list_obj);
+    list->kind = kind;
+    if (count > 0) {
+        list->elements = malloc(list_element_size(kind) * count);
+        if (list->elements == NULL) exit(1);
+        memcpy(list->elements, values, list_element_size(kind) * count);
+        list->capacity = count;
+        list->count = count;
+    }
+    return list_obj;
+}
+
+AngaraObject angara_list_new_with_capacity(size_t capacity) {
+    AngaraObject list_obj = angara_list_new();
+    AngaraList* list = AS_LIST(list_obj);
+    if (capacity > 0) {
+        list->elements = (AngaraObject*)malloc(sizeof(AngaraObject) * capacity);
+        if (list->elements == NULL) exit(1);
+        list->capacity = capacity;
+    }
+    return list_obj;
 }
 
 AngaraObject angara_list_new_with_elements(size_t count, AngaraObject elements[]) {
@@ -128,43 +1132,171 @@ AngaraObject angara_list_new_with_elements(size_t count, AngaraObject elements[]
 
 void angara_list_push(AngaraObject list_obj, AngaraObject value) {
     AngaraList* list = AS_LIST(list_obj);
+    if (!fits_list_storage(list, value)) angara_list_unpack(list);
     if (list->capacity < list->count + 1) grow_list_capacity(list);
-    list->elements[list->count] = value;
+    switch (list->kind) {
+        case ANGARA_LIST_I64:  list->i64s[list->count] = AS_I64(value); break;
+        case ANGARA_LIST_F64:  list->f64s[list->count] = AS_F64(value); break;
+        case ANGARA_LIST_BOOL: list->bools[list->count] = AS_BOOL(value); break;
+        default:
+            list->elements[list->count] = angara_retain_for_store(&list->obj, value);
+            if (angara_store_failed()) return;
+            break;
+    }
     list->count++;
-    angara_incref(value);
+    list->mod_stamp++;
+}
+
+// The list form of `range`, for when it is used as a value rather than iterated.
+AngaraObject angara_range(int64_t start, int64_t end, int64_t step) {
+    AngaraObject list_obj = angara_list_new_packed(ANGARA_LIST_I64, 0, NULL);
+    for (int64_t i = start; step > 0 ? i < end : step < 0 && i > end; i = angara_range_advance(i, end, step)) {
+        angara_fast_list_push_i64(list_obj, i);
+    }
+    return list_obj;
 }
 
 AngaraObject angara_list_get(AngaraObject list_obj, AngaraObject index_obj) {
-    AngaraList* list = AS_LIST(list_obj);
-    int64_t index = AS_I64(index_obj);
-    if (index < 0 || index >= list->count) return angara_create_nil();
-    AngaraObject value = list->elements[index];
-    angara_incref(value);
-    return value;
+    return angara_fast_list_get(list_obj, index_obj);
 }
 
 void angara_list_set(AngaraObject list_obj, AngaraObject index_obj, AngaraObject value) {
-    AngaraList* list = AS_LIST(list_obj);
-    int64_t index = AS_I64(index_obj);
-    if (index < 0 || index >= list->count) return;
-    angara_decref(list->elements[index]);
-    list->elements[index] = value;
-    angara_incref(value);
+    angara_fast_list_set(list_obj, index_obj, value);
 }
 
-// --- Record Implementation (STUBBED) ---
+int64_t angara_list_get_i64(AngaraObject list_obj, int64_t index) { return angara_fast_list_get_i64(list_obj, index); }
+double angara_list_get_f64(AngaraObject list_obj, int64_t index) { return angara_fast_list_get_f64(list_obj, index); }
+bool angara_list_get_bool(AngaraObject list_obj, int64_t index) { return angara_fast_list_get_bool(list_obj, index); }
+void angara_list_set_i64(AngaraObject list_obj, int64_t index, int64_t value) { angara_fast_list_set_i64(list_obj, index, value); }
+void angara_list_set_f64(AngaraObject list_obj, int64_t index, double value) { angara_fast_list_set_f64(list_obj, index, value); }
+void angara_list_set_bool(AngaraObject list_obj, int64_t index, bool value) { angara_fast_list_set_bool(list_obj, index, value); }
+void angara_list_push_i64(AngaraObject list_obj, int64_t value) { angara_fast_list_push_i64(list_obj, value); }
+void angara_list_push_f64(AngaraObject list_obj, double value) { angara_fast_list_push_f64(list_obj, value); }
+void angara_list_push_bool(AngaraObject list_obj, bool value) { angara_fast_list_push_bool(list_obj, value); }
+
+// --- Record Implementation ---
+// Small records are scanned linearly (comparing cached hashes before keys);
+// larger ones get a hash index over the insertion-ordered entries array.
+#define RECORD_INDEX_THRESHOLD 8
+
 AngaraObject angara_record_new(void) {
-    AngaraRecord* record = (AngaraRecord*)malloc(sizeof(AngaraRecord));
+    AngaraRecord* record = (AngaraRecord*)angara_object_alloc(sizeof(AngaraRecord), OBJ_RECORD);
     if (record == NULL) {
         // In a real-world scenario, handle allocation failure gracefully.
         exit(1);
     }
-    record->obj.type = OBJ_RECORD;
-    record->obj.ref_count = 1;
     record->count = 0;
     record->capacity = 0;
     record->entries = NULL;
-    return (AngaraObject){VAL_OBJ, {.obj = (Object*)record}};
+    record->index = NULL;
+    record->index_capacity = 0;
+    return ANGARA_OBJ_VAL(record);
+}
+
+// A key being looked up or stored, with its hash. `interned` is the key's
+// canonical string when it is an interned literal, otherwise NULL.
+struct RecordKey {
+    const char* chars;
+    size_t length;
+    uint32_t hash;
+    AngaraString* interned;
+};
+
+static RecordKey record_key_from_chars(const char* chars) {
+    size_t length = strlen(chars);
+    RecordKey key = { chars, length, hash_bytes(chars, length), NULL };
+    return key;
+}
+
+// A string key brings its cached hash along.
+static RecordKey record_key_from_string(AngaraString* string) {
+    RecordKey key = { string->chars, string->length, angara_string_hash(string),
+                      (string->obj.flags & ANGARA_OBJ_INTERNED) ? string : NULL };
+    return key;
+}
+
+// --- Key Interning ---
+// A process-wide set of canonical, immortal strings, one per distinct string
+// literal. A record entry keyed by a literal stores the canonical pointer, so
+// a lookup with a literal key is a pointer comparison. Only literals are
+// interned, which bounds the table by the program text; entries are never removed.
+static struct {
+    AngaraString** slots;
+    size_t capacity; // Always zero or a power of two.
+    size_t count;
+    pthread_mutex_t lock;
+} g_interned = { NULL, 0, 0, PTHREAD_MUTEX_INITIALIZER };
+
+// Returns the slot holding the key's text, or the empty slot where it belongs.
+// Canonical strings always have their hash cached. The caller must hold the lock.
+static AngaraString** find_interned_slot(const RecordKey* key) {
+    size_t mask = g_interned.capacity - 1;
+    for (size_t slot = key->hash & mask;; slot = (slot + 1) & mask) {
+        AngaraString* entry = g_interned.slots[slot];
+        if (entry == NULL) return &g_interned.slots[slot];
+        if (entry->hash == key->hash && entry->length == key->length &&
+            bytes_equal(entry->chars, key->chars, key->length)) {
+            return &g_interned.slots[slot];
+        }
+    }
+}
+
+static void grow_intern_table(void) {
+    AngaraString** old_slots = g_interned.slots;
+    size_t old_capacity = g_interned.capacity;
+    g_interned.capacity = old_capacity < 256 ? 256 : old_capacity * 2;
+    g_interned.slots = (AngaraString**)calloc(g_interned.capacity, sizeof(AngaraString*));
+    if (g_interned.slots == NULL) {
+        exit(1); // Handle allocation failure
+    }
+    for (size_t i = 0; i < old_capacity; i++) {
+        if (old_slots[i] != NULL) {
+            RecordKey key = { old_slots[i]->chars, old_slots[i]->length, old_slots[i]->hash, NULL };
+            *find_interned_slot(&key) = old_slots[i];
+        }
+    }
+    free(old_slots);
+}
+
+// Returns the canonical string for the key's text. When the text is new, `candidate`
+// (an immortal string) becomes the canonical one.
+static AngaraString* intern_string(const RecordKey* key, AngaraString* candidate) {
+    pthread_mutex_lock(&g_interned.lock);
+    if ((g_interned.count + 1) * 2 > g_interned.capacity) grow_intern_table();
+
+    AngaraString** slot = find_interned_slot(key);
+    if (*slot == NULL) {
+        candidate->hash = key->hash;
+        candidate->obj.flags |= ANGARA_OBJ_INTERNED;
+        *slot = candidate;
+        g_interned.count++;
+    }
+    AngaraString* canonical = *slot;
+    pthread_mutex_unlock(&g_interned.lock);
+    return canonical;
+}
+
+// Called by generated code at module initialization for each string literal,
+// so that literal record keys hit the pointer-equality path.
+void angara_intern_literal(AngaraString* literal) {
+    RecordKey key = record_key_from_string(literal);
+    AngaraString* canonical = intern_string(&key, literal);
+    literal->chars = canonical->chars;
+    literal->obj.flags |= ANGARA_OBJ_INTERNED;
+}
+
+// The string a new entry keeps for its key: the canonical one for a literal,
+// otherwise a counted copy the entry owns. Copies never change, so they are
+// allocated outside regions and marked SHARED from the start, like wide integers.
+static AngaraString* record_key_string(const RecordKey* key) {
+    if (key->interned != NULL) return key->interned;
+    AngaraRegion* region = suspend_regions();
+    AngaraString* copy = allocate_string(key->length);
+    resume_regions(region);
+    memcpy(copy->chars, key->chars, key->length);
+    copy->hash = key->hash;
+    copy->obj.flags |= ANGARA_OBJ_SHARED;
+    return copy;
 }
 
 // Helper to grow the dynamic array of record entries.
@@ -177,178 +1309,791 @@ static void grow_record_capacity(AngaraRecord* record) {
     }
 }
 
+// Places entry `position` into the index with linear probing.
+static void record_index_insert(AngaraRecord* record, size_t position) {
+    size_t mask = record->index_capacity - 1;
+    size_t slot = record->entries[position].hash & mask;
+    while (record->index[slot] != 0) slot = (slot + 1) & mask;
+    record->index[slot] = (uint32_t)(position + 1);
+}
+
+// (Re)builds the index from the entries array, sized to keep the load below 1/2.
+static void rebuild_record_index(AngaraRecord* record) {
+    size_t capacity = 16;
+    while (capacity < record->count * 2) capacity *= 2;
+    free(record->index);
+    record->index = (uint32_t*)calloc(capacity, sizeof(uint32_t));
+    if (record->index == NULL) {
+        exit(1); // Handle allocation failure
+    }
+    record->index_capacity = capacity;
+    for (size_t i = 0; i < record->count; i++) record_index_insert(record, i);
+}
+
+// Compares a stored key against a lookup key. Two interned keys are equal
+// exactly when the pointers are; a slice may start at the same bytes as a
+// longer key, so any other pair compares hashes and lengths first.
+static inline bool record_key_matches(const RecordEntry* entry, const RecordKey* key) {
+    if (key->interned != NULL && (entry->key_string->obj.flags & ANGARA_OBJ_INTERNED)) {
+        return entry->key == key->chars;
+    }
+    return entry->hash == key->hash && entry->key_string->length == key->length &&
+           (entry->key == key->chars || bytes_equal(entry->key, key->chars, key->length));
+}
+
+// Returns the position of `key` in the entries array, or -1 if it is absent.
+static int64_t find_record_entry(const AngaraRecord* record, const RecordKey* key) {
+    if (record->index == NULL) {
+        for (size_t i = 0; i < record->count; i++) {
+            if (record_key_matches(&record->entries[i], key)) return (int64_t)i;
+        }
+        return -1;
+    }
+
+    size_t mask = record->index_capacity - 1;
+    for (size_t slot = key->hash & mask; record->index[slot] != 0; slot = (slot + 1) & mask) {
+        if (record_key_matches(&record->entries[record->index[slot] - 1], key)) {
+            return (int64_t)(record->index[slot] - 1);
+        }
+    }
+    return -1;
+}
+
 // Sets a field on a record. If the key already exists, it updates the value.
 // Otherwise, it adds a new key-value pair.
+static void record_set_entry(AngaraRecord* record, const RecordKey* key, AngaraObject value) {
+    // 1. Check if the key already exists.
+    int64_t found = find_record_entry(record, key);
+    if (found != -1) {
+        // Key found. Take the new reference before dropping the old one, in case they alias.
+        value = angara_retain_for_store(&record->obj, value);
+        if (angara_store_failed()) return;
+        angara_decref(record->entries[found].value);
+        record->entries[found].value = value;
+        return;
+    }
+
+    // 2. Key not found. Add a new entry, holding its own reference to the value.
+    value = angara_retain_for_store(&record->obj, value);
+    if (angara_store_failed()) return;
+    // Ensure there is enough capacity.
+    if (record->capacity < record->count + 1) {
+        grow_record_capacity(record);
+    }
+
+    // 3. Add the new entry to the end, preserving insertion order.
+    size_t position = record->count;
+    RecordEntry* entry = &record->entries[position];
+    record->count++;
+
+    AngaraString* key_string = record_key_string(key);
+    entry->key = key_string->chars;
+    entry->key_string = key_string;
+    entry->value = value;
+    entry->hash = key->hash;
+
+    // 4. Keep the index in step, creating or doubling it as needed.
+    if (record->index == NULL) {
+        if (record->count > RECORD_INDEX_THRESHOLD) rebuild_record_index(record);
+    } else if (record->count * 2 > record->index_capacity) {
+        rebuild_record_index(record);
+    } else {
+        record_index_insert(record, position);
+    }
+}
+
 void angara_record_set(AngaraObject record_obj, const char* key, AngaraObject value) {
     if (!IS_OBJ(record_obj) || OBJ_TYPE(record_obj) != OBJ_RECORD) return;
-    AngaraRecord* record = AS_RECORD(record_obj);
+    RecordKey record_key = record_key_from_chars(key);
+    record_set_entry(AS_RECORD(record_obj), &record_key, value);
+}
+
+// Gets a field from a record. Returns nil if the key is not found.
+static AngaraObject record_get_entry(AngaraRecord* record, const RecordKey* key) {
+    int64_t found = find_record_entry(record, key);
+    if (found == -1) {
+        // Not found.
+        return angara_create_nil();
+    }
+
+    // Found it. Incref the value before returning it.
+    angara_incref(record->entries[found].value);
+    return record->entries[found].value;
+}
+
+AngaraObject angara_record_get(AngaraObject record_obj, const char* key) {
+    if (!IS_OBJ(record_obj) || OBJ_TYPE(record_obj) != OBJ_RECORD) return angara_create_nil();
+    RecordKey record_key = record_key_from_chars(key);
+    return record_get_entry(AS_RECORD(record_obj), &record_key);
+}
+
+// The constructor used by the transpiler for record literals.
+// `kvs` is an array of [key1, value1, key2, value2, ...].
+AngaraObject angara_record_new_with_fields(size_t pair_count, AngaraObject kvs[]) {
+    AngaraObject record_obj = angara_record_new();
+
+    for (size_t i = 0; i < pair_count; i++) {
+        AngaraObject key_obj = kvs[i * 2];
+        AngaraObject value_obj = kvs[i * 2 + 1];
+
+        // The key from a literal is always an AngaraString, usually an interned one.
+        RecordKey key = record_key_from_string(AS_STRING(key_obj));
+        record_set_entry(AS_RECORD(record_obj), &key, value_obj);
+    }
+
+    // The key and value objects in the kvs array were temporary and owned by the
+    // caller. `record_set_entry` has already incref'd the values and copied any
+    // keys that are not interned, so we don't need to do anything with the kvs array itself.
+
+    return record_obj;
+}
+
+// --- Internal Helper Implementations ---
+static void free_string(AngaraString* string) {
+    release_string_chars(string);
+    angara_object_free((Object*)string);
+}
+static void free_list(AngaraList* list) {
+    if (list->kind == ANGARA_LIST_BOXED) {
+        for (size_t i = 0; i < list->count; i++) angara_decref(list->elements[i]);
+    }
+    free(list->elements);
+    angara_object_free((Object*)list);
+}
+
+// Update the memory manager and printer
+static void free_mutex(AngaraMutex* mutex) {
+    pthread_mutex_destroy(&mutex->handle);
+    angara_object_free((Object*)mutex);
+}
+
+// A task's closure and arguments are already released once it has run. An OS
+// thread nobody joined is detached, so its resources go back when it ends.
+static void free_thread(AngaraThread* thread) {
+    if (!thread->is_task && !thread->joined) pthread_detach(thread->handle);
+    angara_decref(thread->return_value);
+    angara_object_free((Object*)thread);
+}
+
+static void free_string_builder(AngaraStringBuilder* builder) {
+    free(builder->chars);
+    angara_object_free((Object*)builder);
+}
+
+// The memory cleanup function for a record object.
+static void free_record(AngaraRecord* record) {
+    for (size_t i = 0; i < record->count; i++) {
+        // Interned keys are immortal, so this only frees the copied ones.
+        angara_decref(ANGARA_OBJ_VAL(record->entries[i].key_string));
+        angara_decref(record->entries[i].value);
+    }
+    // Free the array of entries itself, and its index.
+    free(record->entries);
+    free(record->index);
+    // Free the record struct.
+    angara_object_free((Object*)record);
+}
+
+AngaraObject angara_create_native_instance(void* data, AngaraFinalizerFn finalizer) {
+    AngaraNativeInstance* instance = (AngaraNativeInstance*)angara_object_alloc(sizeof(AngaraNativeInstance), OBJ_NATIVE_INSTANCE);
+    instance->data = data;
+    instance->finalizer = finalizer;
+    return ANGARA_OBJ_VAL(instance);
+}
+
+static void free_native_instance(AngaraNativeInstance* instance) {
+    // If the module provided a finalizer, call it with the custom data pointer.
+    if (instance->finalizer) {
+        instance->finalizer(instance->data);
+    }
+    // Then, free the container struct itself.
+    angara_object_free((Object*)instance);
+}
+
+// 2. Update the memory manager
+static void free_exception(AngaraException* exc) {
+    angara_decref(exc->message); // Release the reference to the message string
+    angara_object_free((Object*)exc);
+}
+
+// Data and enum instances point to their type's drop function for their fields.
+static void free_data_instance(Object* object) {
+    const AngaraTypeOps* ops = ((AngaraDataInstance*)object)->ops;
+    if (ops != NULL && ops->drop != NULL) ops->drop(object);
+    angara_object_free(object);
+}
+
+static void free_object(Object* object) {
+    // printf("-- freeing object of type %d --\n", object->type);
+    // Region-owned objects are released together when their region ends.
+    if (object->flags & ANGARA_OBJ_REGION) return;
+    switch (object->type) {
+        case OBJ_STRING: free_string((AngaraString*)object); break;
+        case OBJ_LIST: free_list((AngaraList*)object); break;
+        case OBJ_RECORD: free_record((AngaraRecord*)object); break;
+        case OBJ_NATIVE_INSTANCE: free_native_instance((AngaraNativeInstance*)object); break;
+        case OBJ_DATA_INSTANCE: free_data_instance(object); break;
+        case OBJ_CLOSURE: angara_object_free(object); break;
+        case OBJ_INSTANCE: {
+            // The class's compiler-generated drop releases the fields first.
+            AngaraClass* klass = ((AngaraInstance*)object)->klass;
+            if (klass->drop != NULL) klass->drop(object);
+            angara_object_free(object);
+            break;
+        }
+        case OBJ_CLASS:
+            // Classes can be global/static, may not need freeing,
+            // or may need their name freed.
+            free(((AngaraClass*)object)->name);
+            free(object);
+            break;
+        case OBJ_MUTEX: free_mutex((AngaraMutex*)object); break; // <-- ADD THIS
+        case OBJ_THREAD: free_thread((AngaraThread*)object); break;
+        case OBJ_STRING_BUILDER: free_string_builder((AngaraStringBuilder*)object); break;
+        case OBJ_EXCEPTION: free_exception((AngaraException*)object); break;
+        case OBJ_ENUM_INSTANCE: free_data_instance(object); break;
+        case OBJ_WIDE_I64: angara_object_free(object); break;
+        default: break;
+    }
+}
+
+// --- Cycle Collector ---
+// The synchronous trial-deletion collector of Bacon and Rajan ("Concurrent Cycle
+// Collection in Reference Counted Systems", 2001). Starting from the buffered
+// candidates, it subtracts every reference found inside the candidates' subgraph
+// (mark gray). Whatever still has a count left is referenced from outside, and
+// so is everything it reaches (scan black). The rest (white) is only kept alive
+// by itself: its fields are cleared, which releases it through the normal path.
+// Only thread-private, counted lists, records and instances take part; shared,
+// immortal and region objects count as references from outside.
+enum { GC_BLACK = 0, GC_GRAY = 1, GC_WHITE = 2, GC_GARBAGE = 3 };
+
+static inline uint32_t gc_color(const Object* object) {
+    return (object->flags & ANGARA_OBJ_COLOR_MASK) >> ANGARA_OBJ_COLOR_SHIFT;
+}
+
+static inline void gc_set_color(Object* object, uint32_t color) {
+    object->flags = (uint8_t)((object->flags & ~ANGARA_OBJ_COLOR_MASK) | (color << ANGARA_OBJ_COLOR_SHIFT));
+}
+
+static void gc_push(GCStack* stack, Object* object) {
+    if (stack->count == stack->capacity) {
+        stack->capacity = stack->capacity < 64 ? 64 : stack->capacity * 2;
+        stack->items = (Object**)realloc(stack->items, stack->capacity * sizeof(Object*));
+        if (stack->items == NULL) {
+            exit(1); // Handle allocation failure
+        }
+    }
+    stack->items[stack->count++] = object;
+}
+
+// Visits every reference slot of an object the collector can walk.
+static void gc_traverse(Object* object, AngaraVisitFn visit, void* context) {
+    switch (object->type) {
+        case OBJ_LIST: {
+            AngaraList* list = (AngaraList*)object;
+            if (list->kind != ANGARA_LIST_BOXED) break;
+            for (size_t i = 0; i < list->count; i++) visit(&list->elements[i], context);
+            break;
+        }
+        case OBJ_RECORD: {
+            AngaraRecord* record = (AngaraRecord*)object;
+            for (size_t i = 0; i < record->count; i++) visit(&record->entries[i].value, context);
+            break;
+        }
+        case OBJ_INSTANCE: {
+            AngaraClass* klass = ((AngaraInstance*)object)->klass;
+            if (klass->traverse != NULL) klass->traverse(object, visit, context);
+            break;
+        }
+        case OBJ_DATA_INSTANCE:
+        case OBJ_ENUM_INSTANCE: {
+            const AngaraTypeOps* ops = ((AngaraDataInstance*)object)->ops;
+            if (ops != NULL && ops->traverse != NULL) ops->traverse(object, visit, context);
+            break;
+        }
+        default: break;
+    }
+}
+
+// The object in `slot`, if it is one the collector tracks.
+static inline Object* gc_child(const AngaraObject* slot) {
+    if (!IS_OBJ(*slot)) return NULL;
+    Object* child = AS_OBJ(*slot);
+    if (child->flags & (ANGARA_OBJ_SHARED | ANGARA_OBJ_UNCOUNTED)) return NULL;
+    return (ANGARA_CYCLIC_TYPES & (1u << child->type)) ? child : NULL;
+}
+
+static void gc_visit_mark_gray(AngaraObject* slot, void* context) {
+    Object* child = gc_child(slot);
+    if (child == NULL) return;
+    child->ref_count--;
+    if (gc_color(child) != GC_GRAY) {
+        gc_set_color(child, GC_GRAY);
+        gc_push((GCStack*)context, child);
+    }
+}
+
+static void gc_visit_scan_black(AngaraObject* slot, void* context) {
+    Object* child = gc_child(slot);
+    if (child == NULL) return;
+    child->ref_count++;
+    if (gc_color(child) != GC_BLACK) {
+        gc_set_color(child, GC_BLACK);
+        gc_push((GCStack*)context, child);
+    }
+}
+
+static void gc_visit_scan(AngaraObject* slot, void* context) {
+    Object* child = gc_child(slot);
+    if (child != NULL && gc_color(child) == GC_GRAY) gc_push((GCStack*)context, child);
+}
+
+static void gc_visit_collect_white(AngaraObject* slot, void* context) {
+    Object* child = gc_child(slot);
+    if (child != NULL && gc_color(child) == GC_WHITE) {
+        gc_set_color(child, GC_GARBAGE);
+        gc_push((GCStack*)context, child);
+    }
+}
+
+static void gc_visit_restore(AngaraObject* slot, void* context) {
+    (void)context;
+    Object* child = gc_child(slot);
+    if (child != NULL) child->ref_count++;
+}
+
+static void gc_visit_clear(AngaraObject* slot, void* context) {
+    (void)context;
+    AngaraObject old = *slot;
+    *slot = ANGARA_NIL_VAL;
+    angara_decref(old);
+}
+
+// Subtracts the references from inside the subgraph reachable from `root`.
+static void gc_mark_gray(Object* root, GCStack* stack) {
+    if (gc_color(root) == GC_GRAY) return;
+    gc_set_color(root, GC_GRAY);
+    gc_push(stack, root);
+    while (stack->count > 0) gc_traverse(stack->items[--stack->count], gc_visit_mark_gray, stack);
+}
 
-    // 1. Check if the key already exists (linear search).
-    for (size_t i = 0; i < record->count; i++) {
-        if (strcmp(record->entries[i].key, key) == 0) {
-            // Key found. Decref the old value and update it.
-            angara_decref(record->entries[i].value);
-            record->entries[i].value = value;
-            angara_incref(value);
-            return;
+// Colors the gray subgraph from `root` black where it is still referenced from
+// outside (restoring the counts below it), and white where it is not.
+static void gc_scan(Object* root, GCStack* stack, GCStack* black_stack) {
+    gc_push(stack, root);
+    while (stack->count > 0) {
+        Object* object = stack->items[--stack->count];
+        if (gc_color(object) != GC_GRAY) continue;
+        if (object->ref_count > 0) {
+            gc_set_color(object, GC_BLACK);
+            gc_push(black_stack, object);
+            while (black_stack->count > 0) {
+                gc_traverse(black_stack->items[--black_stack->count], gc_visit_scan_black, black_stack);
+            }
+        } else {
+            gc_set_color(object, GC_WHITE);
+            gc_traverse(object, gc_visit_scan, stack);
         }
     }
+}
 
-    // 2. Key not found. Add a new entry.
-    // Ensure there is enough capacity.
-    if (record->capacity < record->count + 1) {
-        grow_record_capacity(record);
+// Appends the white subgraph from `root` to `garbage`.
+static void gc_collect_white(Object* root, GCStack* garbage) {
+    if (gc_color(root) != GC_WHITE) return;
+    gc_set_color(root, GC_GARBAGE);
+    gc_push(garbage, root);
+    for (size_t i = garbage->count - 1; i < garbage->count; i++) {
+        gc_traverse(garbage->items[i], gc_visit_collect_white, garbage);
     }
-
-    // 3. Add the new entry to the end.
-    RecordEntry* entry = &record->entries[record->count];
-    record->count++;
-
-    // The record must own its keys. We must copy the provided string.
-    entry->key = strdup(key);
-    entry->value = value;
-    angara_incref(value);
 }
 
-// Gets a field from a record. Returns nil if the key is not found.
-AngaraObject angara_record_get(AngaraObject record_obj, const char* key) {
-    if (!IS_OBJ(record_obj) || OBJ_TYPE(record_obj) != OBJ_RECORD) return angara_create_nil();
-    AngaraRecord* record = AS_RECORD(record_obj);
+void angara_gc_possible_root(Object* object) {
+    // Objects are only colored while a collection runs, and the ones it is
+    // releasing must not come back as candidates.
+    if (gc_color(object) != GC_BLACK) return;
+    object->flags |= ANGARA_OBJ_MARKED;
+    gc_push(&t_gc.roots, object);
+}
 
-    // Linearly search for the key.
-    for (size_t i = 0; i < record->count; i++) {
-        if (strcmp(record->entries[i].key, key) == 0) {
-            // Found it. Incref the value before returning it.
-            angara_incref(record->entries[i].value);
-            return record->entries[i].value;
+static void unbuffer_cycle_root(Object* object) {
+    object->flags &= ~ANGARA_OBJ_MARKED;
+    GCStack* roots = &t_gc.roots;
+    for (size_t i = roots->count; i-- > 0;) {
+        if (roots->items[i] == object) {
+            roots->items[i] = roots->items[--roots->count];
+            return;
         }
     }
+}
 
-    // Not found.
-    return angara_create_nil();
+static double gc_now(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
 }
 
-// The constructor used by the transpiler for record literals.
-// `kvs` is an array of [key1, value1, key2, value2, ...].
-AngaraObject angara_record_new_with_fields(size_t pair_count, AngaraObject kvs[]) {
-    AngaraObject record_obj = angara_record_new();
+// ANGARA_GC_VERBOSE is read once, not on every collection.
+static bool g_gc_verbose;
+static pthread_once_t g_gc_verbose_once = PTHREAD_ONCE_INIT;
 
-    for (size_t i = 0; i < pair_count; i++) {
-        AngaraObject key_obj = kvs[i * 2];
-        AngaraObject value_obj = kvs[i * 2 + 1];
+static void read_gc_verbose(void) {
+    g_gc_verbose = getenv("ANGARA_GC_VERBOSE") != NULL;
+}
+
+static bool gc_verbose(void) {
+    pthread_once(&g_gc_verbose_once, read_gc_verbose);
+    return g_gc_verbose;
+}
 
-        // The key from a literal is always an AngaraString. We need its C chars.
-        const char* key_cstr = AS_CSTRING(key_obj);
+int64_t angara_gc_collect(void) {
+    if (t_gc.collecting) return 0;
+    t_gc.collecting = true;
+    double start = gc_now();
+    GCStack* roots = &t_gc.roots;
+    GCStack stack = {NULL, 0, 0};
+    GCStack black_stack = {NULL, 0, 0};
+    GCStack garbage = {NULL, 0, 0};
 
-        angara_record_set(record_obj, key_cstr, value_obj);
+    // 1. Mark roots: candidates that died while buffered only need their memory
+    //    released; the rest have their internal references subtracted. (Dead
+    //    roots are weeded out first, as marking brings live counts to zero too.)
+    size_t candidates = 0;
+    for (size_t i = 0; i < roots->count; i++) {
+        Object* object = roots->items[i];
+        if (object->ref_count == 0) {
+            object->flags &= ~ANGARA_OBJ_MARKED;
+            angara_object_free(object);
+            continue;
+        }
+        roots->items[candidates++] = object;
+    }
+    roots->count = candidates;
+    for (size_t i = 0; i < roots->count; i++) gc_mark_gray(roots->items[i], &stack);
+
+    // 2. Scan: anything still referenced from outside is live again.
+    for (size_t i = 0; i < roots->count; i++) gc_scan(roots->items[i], &stack, &black_stack);
+
+    // 3. Collect the white objects. The buffer is empty from here on, so the
+    //    releases below buffer new candidates for the next collection.
+    for (size_t i = 0; i < roots->count; i++) roots->items[i]->flags &= ~ANGARA_OBJ_MARKED;
+    for (size_t i = 0; i < roots->count; i++) gc_collect_white(roots->items[i], &garbage);
+    roots->count = 0;
+
+    // 4. Put back the references the garbage holds, and hold each garbage object
+    //    once more so none is freed while its neighbours are being cleared.
+    for (size_t i = 0; i < garbage.count; i++) gc_traverse(garbage.items[i], gc_visit_restore, NULL);
+    for (size_t i = 0; i < garbage.count; i++) garbage.items[i]->ref_count++;
+
+    // 5. Clear every field of the garbage, releasing whatever it references,
+    //    then drop the holds, which frees the now empty objects.
+    for (size_t i = 0; i < garbage.count; i++) gc_traverse(garbage.items[i], gc_visit_clear, NULL);
+    for (size_t i = 0; i < garbage.count; i++) {
+        Object* object = garbage.items[i];
+        gc_set_color(object, GC_BLACK);
+        angara_decref(ANGARA_OBJ_VAL(object));
     }
 
-    // The key and value objects in the kvs array were temporary and owned by the
-    // caller. `angara_record_set` has already incref'd the values and copied the
-    // keys, so we don't need to do anything with the kvs array itself.
+    int64_t reclaimed = (int64_t)garbage.count;
+    free(stack.items);
+    free(black_stack.items);
+    free(garbage.items);
+
+    // 6. A collection that finds little garbage among many candidates is mostly
+    //    wasted work, so the next one waits for a fuller buffer.
+    if ((size_t)reclaimed * 4 < candidates) {
+        t_gc.threshold = t_gc.threshold * 2 < GC_MAX_THRESHOLD ? t_gc.threshold * 2 : GC_MAX_THRESHOLD;
+    } else {
+        t_gc.threshold = GC_INITIAL_THRESHOLD;
+    }
 
-    return record_obj;
+    double pause = gc_now() - start;
+    AngaraGCStats* stats = &t_gc.stats;
+    stats->collections++;
+    stats->reclaimed += reclaimed;
+    stats->last_reclaimed = reclaimed;
+    stats->pause_total += pause;
+    stats->pause_last = pause;
+    if (pause > stats->pause_max) stats->pause_max = pause;
+    if (gc_verbose()) {
+        fprintf(stderr, "[gc] collection %lld: %zu candidates, %lld reclaimed, %.3f ms\n",
+                (long long)stats->collections, candidates, (long long)reclaimed, pause * 1000.0);
+    }
+    t_gc.collecting = false;
+    return reclaimed;
 }
 
-// --- Internal Helper Implementations ---
-static void free_string(AngaraString* string) {
-    free(string->chars);
-    free(string);
+AngaraGCStats angara_gc_stats(void) {
+    return t_gc.stats;
 }
-static void free_list(AngaraList* list) {
-    for (size_t i = 0; i < list->count; i++) angara_decref(list->elements[i]);
-    free(list->elements);
-    free(list);
+
+// Collects what a finishing thread leaves in its buffer and frees the buffer.
+static void release_cycle_roots(void) {
+    if (t_gc.roots.count > 0) angara_gc_collect();
+    free(t_gc.roots.items);
+    t_gc.roots = (GCStack){NULL, 0, 0};
 }
 
-// Update the memory manager and printer
-static void free_mutex(AngaraMutex* mutex) {
-    pthread_mutex_destroy(&mutex->handle);
-    free(mutex);
+// --- Regions ---
+static inline uint32_t region_depth(const Object* object) {
+    return object->region_depth;
 }
 
-// The memory cleanup function for a record object.
-static void free_record(AngaraRecord* record) {
-    for (size_t i = 0; i < record->count; i++) {
-        // Free the copied key string.
-        free(record->entries[i].key);
-        // Decref the value AngaraObject.
-        angara_decref(record->entries[i].value);
+// Deep-copies the parts of `value` that live in regions deeper than `depth`
+// into the current allocation target. Returns a new reference, or false if
+// the value contains an object the runtime cannot copy.
+static bool copy_value(AngaraObject value, uint32_t depth, AngaraObject* out) {
+    if (!IS_OBJ(value) || region_depth(AS_OBJ(value)) <= depth) {
+        angara_incref(value);
+        *out = value;
+        return true;
     }
-    // Free the array of entries itself.
-    free(record->entries);
-    // Free the record struct.
-    free(record);
-}
 
-AngaraObject angara_create_native_instance(void* data, AngaraFinalizerFn finalizer) {
-    AngaraNativeInstance* instance = (AngaraNativeInstance*)malloc(sizeof(AngaraNativeInstance));
-    instance->obj.type = OBJ_NATIVE_INSTANCE;
-    instance->obj.ref_count = 1;
-    instance->data = data;
-    instance->finalizer = finalizer;
-    return (AngaraObject){VAL_OBJ, {.obj = (Object*)instance}};
+    switch (OBJ_TYPE(value)) {
+        case OBJ_STRING:
+            *out = angara_create_string_with_len(AS_STRING(value)->chars, AS_STRING(value)->length);
+            return true;
+        case OBJ_LIST: {
+            AngaraList* source = AS_LIST(value);
+            if (source->kind != ANGARA_LIST_BOXED) {
+                // Packed elements are plain values; the storage is copied as it is.
+                *out = angara_list_new_packed(source->kind, source->count, source->elements);
+                return true;
+            }
+            *out = angara_list_new();
+            AngaraList* copy = AS_LIST(*out);
+            if (source->count > 0) {
+                copy->elements = (AngaraObject*)malloc(sizeof(AngaraObject) * source->count);
+                if (copy->elements == NULL) {
+                    exit(1); // Handle allocation failure
+                }
+                copy->capacity = source->count;
+            }
+            for (size_t i = 0; i < source->count; i++) {
+                if (!copy_value(source->elements[i], depth, &copy->elements[i])) return false;
+                copy->count++;
+            }
+            return true;
+        }
+        case OBJ_RECORD: {
+            AngaraRecord* source = AS_RECORD(value);
+            *out = angara_record_new();
+            for (size_t i = 0; i < source->count; i++) {
+                AngaraObject field;
+                if (!copy_value(source->entries[i].value, depth, &field)) return false;
+                RecordKey key = record_key_from_string(source->entries[i].key_string);
+                record_set_entry(AS_RECORD(*out), &key, field);
+                angara_decref(field);
+            }
+            return true;
+        }
+        case OBJ_EXCEPTION: {
+            AngaraObject message;
+            if (!copy_value(AS_EXCEPTION(value)->message, depth, &message)) return false;
+            *out = angara_exception_new(message);
+            angara_decref(message);
+            return true;
+        }
+        case OBJ_CLOSURE: {
+            AngaraClosure* closure = AS_CLOSURE(value);
+            *out = angara_closure_new(closure->fn, closure->arity, closure->is_native);
+            return true;
+        }
+        // Class, data, enum and native instances have layouts the runtime cannot walk.
+        default:
+            *out = angara_create_nil();
+            return false;
+    }
 }
 
-static void free_native_instance(AngaraNativeInstance* instance) {
-    // If the module provided a finalizer, call it with the custom data pointer.
-    if (instance->finalizer) {
-        instance->finalizer(instance->data);
+// Copies `value` out of every region deeper than `depth`, into the region at
+// `depth` (the heap for 0). A value that is already shallow enough is
+// returned as is; a copy carries one reference, taking over the caller's.
+static bool copy_out_of_region(AngaraObject value, uint32_t depth, AngaraObject* out) {
+    if (!IS_OBJ(value) || region_depth(AS_OBJ(value)) <= depth) {
+        *out = value;
+        return true;
     }
-    // Then, free the container struct itself.
-    free(instance);
+
+    AngaraRegion* current = t_current_region;
+    AngaraRegion* target = current;
+    while (target != NULL && target->depth > depth) target = target->parent;
+    t_current_region = target;
+    bool copied = copy_value(value, depth, out);
+    t_current_region = current;
+    if (!copied) {
+        angara_decref(*out);
+        *out = angara_create_nil();
+    }
+    return copied;
 }
 
-// 2. Update the memory manager
-static void free_exception(AngaraException* exc) {
-    angara_decref(exc->message); // Release the reference to the message string
-    free(exc);
+AngaraObject angara_retain_for_store(Object* container, AngaraObject value) {
+    if (IS_OBJ(value) && region_depth(AS_OBJ(value)) > region_depth(container)) {
+        // The container outlives the value's region; it keeps a copy instead.
+        if (!copy_out_of_region(value, region_depth(container), &value)) {
+            angara_throw_error("Runtime Error: A value allocated in a region cannot be stored outside of it.");
+        }
+    } else {
+        angara_incref(value);
+    }
+    // Anything stored into a shared container becomes reachable from other threads.
+    if (container->flags & ANGARA_OBJ_SHARED) angara_share(value);
+    return value;
 }
 
-static void free_object(Object* object) {
-    // printf("-- freeing object of type %d --\n", object->type);
+// Drops what a region object owns outside the region's chunks.
+static void release_region_object(Object* object) {
     switch (object->type) {
-        case OBJ_STRING: free_string((AngaraString*)object); break;
-        case OBJ_LIST: free_list((AngaraList*)object); break;
-        case OBJ_RECORD: free_record((AngaraRecord*)object); break;
-        case OBJ_NATIVE_INSTANCE: free_native_instance((AngaraNativeInstance*)object); break;
-        case OBJ_DATA_INSTANCE: free(object); break;
-        case OBJ_INSTANCE:
-            // For now, just free the memory. We'll need to handle
-            // decref-ing all fields later. TODO
-            free(object);
+        case OBJ_STRING: release_string_chars((AngaraString*)object); break;
+        case OBJ_LIST: {
+            AngaraList* list = (AngaraList*)object;
+            if (list->kind == ANGARA_LIST_BOXED) {
+                for (size_t i = 0; i < list->count; i++) angara_decref(list->elements[i]);
+            }
+            free(list->elements);
             break;
-        case OBJ_CLASS:
-            // Classes can be global/static, may not need freeing,
-            // or may need their name freed.
-            free(((AngaraClass*)object)->name);
-            free(object);
+        }
+        case OBJ_RECORD: {
+            AngaraRecord* record = (AngaraRecord*)object;
+            for (size_t i = 0; i < record->count; i++) {
+                angara_decref(ANGARA_OBJ_VAL(record->entries[i].key_string));
+                angara_decref(record->entries[i].value);
+            }
+            free(record->entries);
+            free(record->index);
             break;
-        case OBJ_MUTEX: free_mutex((AngaraMutex*)object); break; // <-- ADD THIS
-        case OBJ_EXCEPTION: free_exception((AngaraException*)object); break;
-            // An enum instance might hold AngaraObjects in its payload. We MUST decref them.
-            // This is a complex task. For now, we will assume a simple free, but this
-            // will cause memory leaks if a variant holds a string, list, etc.
-            // TODO: Implement a GC-aware free for enums.
-        case OBJ_ENUM_INSTANCE: free(object); break;
+        }
+        case OBJ_NATIVE_INSTANCE: {
+            AngaraNativeInstance* instance = (AngaraNativeInstance*)object;
+            if (instance->finalizer) instance->finalizer(instance->data);
+            break;
+        }
+        case OBJ_EXCEPTION: angara_decref(((AngaraException*)object)->message); break;
+        case OBJ_INSTANCE: {
+            // Fields may still hold heap values; the generated drop releases them.
+            AngaraClass* klass = ((AngaraInstance*)object)->klass;
+            if (klass->drop != NULL) klass->drop(object);
+            break;
+        }
+        case OBJ_DATA_INSTANCE:
+        case OBJ_ENUM_INSTANCE: {
+            const AngaraTypeOps* ops = ((AngaraDataInstance*)object)->ops;
+            if (ops != NULL && ops->drop != NULL) ops->drop(object);
+            break;
+        }
         default: break;
     }
 }
 
+static void release_region(AngaraRegion* region) {
+    RegionChunk* chunk = region->chunks;
+    while (chunk != NULL) {
+        for (size_t offset = 0; offset < chunk->used;) {
+            size_t size = *(size_t*)(chunk->data + offset);
+            release_region_object((Object*)(chunk->data + offset + sizeof(size_t)));
+            offset += sizeof(size_t) + size;
+        }
+        RegionChunk* next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    free(region);
+}
+
+AngaraRegion* angara_region_begin(void) {
+    uint32_t depth = t_current_region != NULL ? t_current_region->depth + 1 : 1;
+    if (depth > REGION_MAX_DEPTH) {
+        angara_throw_error("Runtime Error: Regions are nested too deeply.");
+        return NULL;
+    }
+    AngaraRegion* region = (AngaraRegion*)malloc(sizeof(AngaraRegion));
+    if (region == NULL) {
+        exit(1); // Handle allocation failure
+    }
+    region->parent = t_current_region;
+    region->chunks = NULL;
+    region->depth = depth;
+    t_current_region = region;
+    return region;
+}
+
+AngaraObject angara_region_end(AngaraRegion* region, AngaraObject result) {
+    // 1. The result escapes to the enclosing region (or the heap).
+    AngaraObject escaped;
+    bool copied = copy_out_of_region(result, region->depth - 1, &escaped);
+
+    // 2. Release this region, and any inner region that was never ended
+    //    because an exception unwound past it.
+    AngaraRegion* parent = region->parent;
+    while (t_current_region != parent) {
+        AngaraRegion* innermost = t_current_region;
+        t_current_region = innermost->parent;
+        release_region(innermost);
+    }
+
+    if (!copied) {
+        angara_throw_error("Runtime Error: A value allocated in a region cannot be returned from it.");
+    }
+    return escaped;
+}
+
+AngaraObject angara_region_run(AngaraObject closure, int arg_count, AngaraObject args[]) {
+    AngaraRegion* region = angara_region_begin();
+
+#ifdef ANGARA_EXCEPTION_RETURNS
+    if (region == NULL) return angara_create_nil();
+    AngaraObject result = angara_call(closure, arg_count, args);
+    if (!angara_exception_pending()) return angara_region_end(region, result);
+
+    // The closure threw. Carry the exception out of the region and leave it pending.
+    angara_decref(result);
+    AngaraObject exception = g_current_exception;
+    g_current_exception = angara_create_nil();
+    AngaraObject escaped = angara_region_end(region, exception);
+    if (!angara_exception_pending()) g_current_exception = escaped;
+    else angara_decref(escaped);
+    return angara_create_nil();
+#else
+    ExceptionFrame frame;
+    frame.prev = g_exception_chain_head;
+    frame.locals = g_owned_locals.count;
+    g_exception_chain_head = &frame;
+    if (ANGARA_SETJMP(frame.buffer) == 0) {
+        AngaraObject result = angara_call(closure, arg_count, args);
+        g_exception_chain_head = frame.prev;
+        return angara_region_end(region, result);
+    }
+
+    // The closure threw (angara_throw has already popped our frame).
+    // Carry the exception out of the region before rethrowing it.
+    AngaraObject exception = g_current_exception;
+    g_current_exception = angara_create_nil();
+    angara_throw(angara_region_end(region, exception));
+    return angara_create_nil();
+#endif
+}
+
 void printObject(AngaraObject obj) {
-    switch (obj.type) {
-        case VAL_NIL:   printf("nil"); break;
-        case VAL_BOOL:  printf(AS_BOOL(obj) ? "true" : "false"); break;
-        case VAL_I64:   printf("%lld", AS_I64(obj)); break;
-        case VAL_F64:   printf("%g", AS_F64(obj)); break;
+    switch (VALUE_TYPE(obj)) {
+        case VAL_NIL:
+        case VAL_BOOL:
+        case VAL_I64:
+        case VAL_F64: {
+            char buffer[ANGARA_NUMBER_TEXT_MAX];
+            fwrite(buffer, 1, (size_t)format_scalar(obj, buffer), stdout);
+            break;
+        }
         case VAL_OBJ:
             switch (OBJ_TYPE(obj)) {
-                case OBJ_STRING: printf("%s", AS_CSTRING(obj)); break;
+                case OBJ_STRING: fwrite(AS_STRING(obj)->chars, 1, AS_STRING(obj)->length, stdout); break;
                 case OBJ_LIST: {
                     AngaraList* list = AS_LIST(obj);
                     printf("[");
                     for (size_t i = 0; i < list->count; i++) {
-                        printObject(list->elements[i]);
+                        AngaraObject element = angara_fast_list_element(list, i);
+                        printObject(element);
+                        if (list->kind != ANGARA_LIST_BOXED) angara_decref(element);
                         if (i < list->count - 1) printf(", ");
                     }
                     printf("]");
@@ -368,6 +2113,7 @@ void printObject(AngaraObject obj) {
                     break;
                 case OBJ_THREAD: printf("<thread>"); break;
                 case OBJ_MUTEX: printf("<mutex>"); break;
+                case OBJ_STRING_BUILDER: printf("<string builder>"); break;
                 case OBJ_RECORD: {
                     AngaraRecord* record = AS_RECORD(obj);
                     printf("{");
@@ -403,72 +2149,88 @@ void printObject(AngaraObject obj) {
 }
 
 Object* angara_instance_new(size_t size, AngaraClass* klass) {
-    AngaraInstance* instance = (AngaraInstance*)malloc(size);
+    AngaraInstance* instance = (AngaraInstance*)angara_object_alloc(size, OBJ_INSTANCE);
     if (instance == NULL) exit(1);
 
-    instance->obj.type = OBJ_INSTANCE;
-    instance->obj.ref_count = 1;
     instance->klass = klass; // Store the pointer to the class object
+    // Fields start out as nil, so the first assignment to one can release the old value.
+    memset((char*)instance + sizeof(AngaraInstance), 0, size - sizeof(AngaraInstance));
 
     return (Object*)instance;
 }
 
 // --- Exception Handling Implementation ---
-AngaraObject g_current_exception;
-jmp_buf g_exception_stack[ANGARA_MAX_EXCEPTION_FRAMES];
-int g_exception_stack_top = 0;
-
-int angara_try_begin(void) {
-    if (g_exception_stack_top >= ANGARA_MAX_EXCEPTION_FRAMES) {
-        printf("Exception stack overflow!\n");
-        exit(1);
+__thread AngaraObject g_current_exception;
+__thread ExceptionFrame* g_exception_chain_head = NULL;
+__thread AngaraLocalStack g_owned_locals = { NULL, 0, 0 };
+
+void angara_grow_owned_locals(void) {
+    g_owned_locals.capacity = g_owned_locals.capacity < 64 ? 64 : g_owned_locals.capacity * 2;
+    g_owned_locals.slots = (AngaraObject**)realloc(g_owned_locals.slots, g_owned_locals.capacity * sizeof(AngaraObject*));
+    if (g_owned_locals.slots == NULL) {
+        exit(1); // Handle allocation failure
     }
-    return setjmp(g_exception_stack[g_exception_stack_top++]);
-}
-
-void angara_try_end(void) {
-    g_exception_stack_top--;
 }
 
-ExceptionFrame* g_exception_chain_head = NULL;
-
 void angara_debug_print(const char* message) {
     // We use fprintf to stderr to make sure it's not buffered
     // and doesn't interfere with the program's stdout.
     fprintf(stderr, "[DEBUG] %s\n", message);
 }
 
+static void exit_unhandled(AngaraObject exception) {
+    fprintf(stderr, "\n" ANSI_COLOR_BOLD_RED "[FATAL] Unhandled Angara Exception" ANSI_COLOR_RESET "\n");
+
+    if (IS_OBJ(exception) && OBJ_TYPE(exception) == OBJ_EXCEPTION) {
+        // The exception is a proper, standard Exception object.
+        fprintf(stderr, ANSI_COLOR_YELLOW "  -> Message: " ANSI_COLOR_RESET "%s\n", AS_CSTRING(AS_EXCEPTION(exception)->message));
+    } else if (IS_OBJ(exception) && OBJ_TYPE(exception) == OBJ_STRING) {
+        // It was a raw string, likely from an old angara_throw_error call.
+        fprintf(stderr, ANSI_COLOR_YELLOW "  -> Message: " ANSI_COLOR_RESET "%s\n", AS_CSTRING(exception));
+    } else {
+        // It's some other non-standard object.
+        fprintf(stderr, ANSI_COLOR_YELLOW "  -> Thrown object was not a standard Exception or String type." ANSI_COLOR_RESET "\n");
+    }
+
+    fprintf(stderr, ANSI_COLOR_CYAN "  -> No active `try` blocks were found on the call stack. Terminating program." ANSI_COLOR_RESET "\n\n");
+    exit(1);
+}
+
+void angara_exit_if_uncaught(void) {
+    if (angara_exception_pending()) exit_unhandled(g_current_exception);
+}
+
 // 2. Enhance the angara_throw function
 void angara_throw(AngaraObject exception) {
+#ifdef ANGARA_EXCEPTION_RETURNS
+    // The caller's reference moves to the pending exception; the generated code
+    // finds it when the current call returns.
+    angara_decref(g_current_exception);
+    g_current_exception = exception;
+#else
     // This function is called for ALL throws. It only terminates if there's
     // no active `try` block to jump to.
-
     if (g_exception_chain_head == NULL) {
         // --- This is the UNHANDLED exception path ---
-
-        fprintf(stderr, "\n" ANSI_COLOR_BOLD_RED "[FATAL] Unhandled Angara Exception" ANSI_COLOR_RESET "\n");
-
-        if (IS_OBJ(exception) && OBJ_TYPE(exception) == OBJ_EXCEPTION) {
-            // The exception is a proper, standard Exception object.
-            fprintf(stderr, ANSI_COLOR_YELLOW "  -> Message: " ANSI_COLOR_RESET "%s\n", AS_CSTRING(AS_EXCEPTION(exception)->message));
-        } else if (IS_OBJ(exception) && OBJ_TYPE(exception) == OBJ_STRING) {
-            // It was a raw string, likely from an old angara_throw_error call.
-            fprintf(stderr, ANSI_COLOR_YELLOW "  -> Message: " ANSI_COLOR_RESET "%s\n", AS_CSTRING(exception));
-        } else {
-            // It's some other non-standard object.
-            fprintf(stderr, ANSI_COLOR_YELLOW "  -> Thrown object was not a standard Exception or String type." ANSI_COLOR_RESET "\n");
-        }
-
-        fprintf(stderr, ANSI_COLOR_CYAN "  -> No active `try` blocks were found on the call stack. Terminating program." ANSI_COLOR_RESET "\n\n");
-        exit(1);
+        exit_unhandled(exception);
     }
 
     // If there IS a try block, we perform the longjmp to it.
+    // The caller's reference moves to the in-flight exception.
     g_current_exception = exception;
-    angara_incref(g_current_exception);
     ExceptionFrame* frame = g_exception_chain_head;
     g_exception_chain_head = frame->prev;
-    longjmp(frame->buffer, 1);
+    // The frames being unwound still exist here, so their owned locals are released now.
+    while (g_owned_locals.count > frame->locals) {
+        angara_decref(*g_owned_locals.slots[--g_owned_locals.count]);
+    }
+#if ANGARA_ASAN
+    // AddressSanitizer only sees library longjmps; tell it the frames in
+    // between are gone.
+    __asan_handle_no_return();
+#endif
+    ANGARA_LONGJMP(frame->buffer);
+#endif
 }
 
 void angara_runtime_init(void) {
@@ -482,6 +2244,317 @@ void angara_runtime_shutdown(void) {
     // allocated objects have been freed (a good way to detect memory leaks).
 }
 
+// --- Task Pool ---
+// `spawn` queues a task for a pool of worker threads, one per core. Each worker
+// owns a Chase-Lev deque (Chase and Lev, "Dynamic Circular Work-Stealing Deque",
+// 2005; the memory orders follow Lê et al., "Correct and Efficient Work-Stealing
+// for Weak Memory Models", 2013): it pushes and pops its own tasks at the bottom
+// without locking, and idle workers steal from the top. Threads outside the pool
+// queue their tasks on a locked list instead. Joining a task that is not done
+// yet runs other pending tasks in the meantime, so recursive fork-join code
+// keeps every worker busy instead of blocking one per `join`.
+#define TASK_DEQUE_INITIAL_CAPACITY 64
+#define POOL_SPINS_BEFORE_SLEEP 32
+// A task run inside a `join` runs on top of the joiner's stack. Past this many
+// nested tasks, a joiner only runs tasks from its own deque, which were spawned
+// further down the same stack, so stealing cannot grow the stack without bound.
+#define POOL_MAX_HELP_DEPTH 16
+
+typedef struct TaskBuffer {
+    int64_t capacity;             // A power of two.
+    struct TaskBuffer* previous;  // Outgrown buffers stay valid for racing thieves.
+    AngaraThread* slots[];
+} TaskBuffer;
+
+typedef struct {
+    int64_t top;                  // Thieves take from here.
+    char pad[56];                 // Keeps the owner's end on another cache line.
+    int64_t bottom;               // The owner pushes and pops here.
+    TaskBuffer* buffer;
+    pthread_t handle;
+} PoolWorker;
+
+static struct {
+    pthread_mutex_t lock;
+    pthread_cond_t work_ready;    // Idle workers sleep here.
+    pthread_cond_t task_done;     // Joiners with nothing left to run sleep here.
+    int idle;                     // Workers asleep on `work_ready`.
+    int worker_count;
+    PoolWorker* workers;
+    AngaraThread* queue_head;     // Tasks spawned outside the pool, oldest first.
+    AngaraThread* queue_tail;
+    int64_t queued;
+} g_pool = { .lock = PTHREAD_MUTEX_INITIALIZER, .work_ready = PTHREAD_COND_INITIALIZER, .task_done = PTHREAD_COND_INITIALIZER };
+static pthread_once_t g_pool_once = PTHREAD_ONCE_INIT;
+// The calling thread's deque when it is one of the pool's workers.
+static __thread PoolWorker* t_worker = NULL;
+// Picks the first victim to steal from.
+static __thread uint64_t t_steal_seed = 0;
+// How many tasks this thread is running inside a `join`.
+static __thread int t_help_depth = 0;
+
+static TaskBuffer* task_buffer_new(int64_t capacity) {
+    TaskBuffer* buffer = (TaskBuffer*)malloc(sizeof(TaskBuffer) + sizeof(AngaraThread*) * (size_t)capacity);
+    if (buffer == NULL) {
+        exit(1); // Handle allocation failure
+    }
+    buffer->capacity = capacity;
+    buffer->previous = NULL;
+    return buffer;
+}
+
+static void deque_push(PoolWorker* worker, AngaraThread* task) {
+    int64_t bottom = __atomic_load_n(&worker->bottom, __ATOMIC_RELAXED);
+    int64_t top = __atomic_load_n(&worker->top, __ATOMIC_ACQUIRE);
+    TaskBuffer* buffer = __atomic_load_n(&worker->buffer, __ATOMIC_RELAXED);
+    if (bottom - top > buffer->capacity - 1) {
+        TaskBuffer* grown = task_buffer_new(buffer->capacity * 2);
+        for (int64_t i = top; i < bottom; i++) {
+            grown->slots[i & (grown->capacity - 1)] = buffer->slots[i & (buffer->capacity - 1)];
+        }
+        grown->previous = buffer;
+        __atomic_store_n(&worker->buffer, grown, __ATOMIC_RELEASE);
+        buffer = grown;
+    }
+    __atomic_store_n(&buffer->slots[bottom & (buffer->capacity - 1)], task, __ATOMIC_RELAXED);
+    // Publishes the task's contents to the thief that acquires `bottom`.
+    __atomic_store_n(&worker->bottom, bottom + 1, __ATOMIC_RELEASE);
+}
+
+static AngaraThread* deque_pop(PoolWorker* worker) {
+    int64_t bottom = __atomic_load_n(&worker->bottom, __ATOMIC_RELAXED) - 1;
+    TaskBuffer* buffer = __atomic_load_n(&worker->buffer, __ATOMIC_RELAXED);
+    __atomic_store_n(&worker->bottom, bottom, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int64_t top = __atomic_load_n(&worker->top, __ATOMIC_RELAXED);
+    if (top > bottom) {
+        __atomic_store_n(&worker->bottom, bottom + 1, __ATOMIC_RELAXED);
+        return NULL;
+    }
+    AngaraThread* task = __atomic_load_n(&buffer->slots[bottom & (buffer->capacity - 1)], __ATOMIC_RELAXED);
+    if (top == bottom) {
+        // The last task: whoever moves `top` first, this worker or a thief, gets it.
+        if (!__atomic_compare_exchange_n(&worker->top, &top, top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+            task = NULL;
+        }
+        __atomic_store_n(&worker->bottom, bottom + 1, __ATOMIC_RELAXED);
+    }
+    return task;
+}
+
+static AngaraThread* deque_steal(PoolWorker* worker) {
+    int64_t top = __atomic_load_n(&worker->top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int64_t bottom = __atomic_load_n(&worker->bottom, __ATOMIC_ACQUIRE);
+    if (top >= bottom) return NULL;
+    TaskBuffer* buffer = __atomic_load_n(&worker->buffer, __ATOMIC_ACQUIRE);
+    AngaraThread* task = __atomic_load_n(&buffer->slots[top & (buffer->capacity - 1)], __ATOMIC_RELAXED);
+    if (!__atomic_compare_exchange_n(&worker->top, &top, top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+        return NULL; // Another thief, or the owner, took it first.
+    }
+    return task;
+}
+
+static bool pool_has_work(void) {
+    if (__atomic_load_n(&g_pool.queued, __ATOMIC_SEQ_CST) > 0) return true;
+    for (int i = 0; i < g_pool.worker_count; i++) {
+        PoolWorker* worker = &g_pool.workers[i];
+        if (__atomic_load_n(&worker->bottom, __ATOMIC_SEQ_CST) > __atomic_load_n(&worker->top, __ATOMIC_SEQ_CST)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Own deque first (the newest task, still warm in cache), then the shared
+// queue, then the oldest task of another worker.
+static AngaraThread* pool_find_task(void) {
+    PoolWorker* self = t_worker;
+    AngaraThread* task = self != NULL ? deque_pop(self) : NULL;
+    if (task != NULL) return task;
+
+    if (__atomic_load_n(&g_pool.queued, __ATOMIC_ACQUIRE) > 0) {
+        pthread_mutex_lock(&g_pool.lock);
+        task = g_pool.queue_head;
+        if (task != NULL) {
+            g_pool.queue_head = task->next;
+            if (g_pool.queue_head == NULL) g_pool.queue_tail = NULL;
+            __atomic_sub_fetch(&g_pool.queued, 1, __ATOMIC_SEQ_CST);
+        }
+        pthread_mutex_unlock(&g_pool.lock);
+        if (task != NULL) return task;
+    }
+
+    if (t_steal_seed == 0) t_steal_seed = (uint64_t)(uintptr_t)&t_steal_seed;
+    t_steal_seed = t_steal_seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    int start = (int)((t_steal_seed >> 33) % (uint64_t)g_pool.worker_count);
+    for (int i = 0; i < g_pool.worker_count; i++) {
+        PoolWorker* victim = &g_pool.workers[(start + i) % g_pool.worker_count];
+        if (victim == self) continue;
+        task = deque_steal(victim);
+        if (task != NULL) return task;
+    }
+    return NULL;
+}
+
+static void run_task(AngaraThread* task) {
+    // The task may run inside a `join` of unrelated code: it must not see that
+    // code's `try` frames, pending exception or memory region.
+    ExceptionFrame* chain_head = g_exception_chain_head;
+    AngaraObject pending = g_current_exception;
+    AngaraRegion* region = suspend_regions();
+    g_exception_chain_head = NULL;
+    g_current_exception = angara_create_nil();
+
+    AngaraObject result = angara_call(task->closure, task->arg_count, task->args);
+    angara_exit_if_uncaught();
+
+    g_exception_chain_head = chain_head;
+    g_current_exception = pending;
+    resume_regions(region);
+
+    angara_decref(task->closure);
+    task->closure = angara_create_nil();
+    for (int i = 0; i < task->arg_count; i++) angara_decref(task->args[i]);
+    task->arg_count = 0;
+
+    // The joining thread reads the result, so it must be shared before it is published.
+    task->return_value = angara_share(result);
+    __atomic_store_n(&task->done, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&task->waiting, __ATOMIC_SEQ_CST)) {
+        pthread_mutex_lock(&g_pool.lock);
+        pthread_cond_broadcast(&g_pool.task_done);
+        pthread_mutex_unlock(&g_pool.lock);
+    }
+    angara_decref(ANGARA_OBJ_VAL(task)); // The queue's reference.
+}
+
+static void* pool_worker_routine(void* arg) {
+    t_worker = (PoolWorker*)arg;
+    for (;;) {
+        int spins = 0;
+        AngaraThread* task;
+        while ((task = pool_find_task()) == NULL && spins++ < POOL_SPINS_BEFORE_SLEEP) sched_yield();
+        if (task != NULL) {
+            run_task(task);
+            continue;
+        }
+        // Announce the sleep before the last look, so a spawn either sees an idle
+        // worker to wake or its task is found here.
+        pthread_mutex_lock(&g_pool.lock);
+        __atomic_add_fetch(&g_pool.idle, 1, __ATOMIC_SEQ_CST);
+        if (!pool_has_work()) pthread_cond_wait(&g_pool.work_ready, &g_pool.lock);
+        __atomic_sub_fetch(&g_pool.idle, 1, __ATOMIC_SEQ_CST);
+        pthread_mutex_unlock(&g_pool.lock);
+    }
+    return NULL;
+}
+
+static void init_pool(void) {
+    // ANGARA_WORKERS overrides the default of one worker per online core.
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    const char* override = getenv("ANGARA_WORKERS");
+    if (override != NULL && atoi(override) > 0) count = atoi(override);
+    if (count < 1) count = 1;
+
+    g_pool.worker_count = (int)count;
+    g_pool.workers = (PoolWorker*)calloc((size_t)count, sizeof(PoolWorker));
+    if (g_pool.workers == NULL) {
+        exit(1); // Handle allocation failure
+    }
+    for (int i = 0; i < g_pool.worker_count; i++) {
+        g_pool.workers[i].buffer = task_buffer_new(TASK_DEQUE_INITIAL_CAPACITY);
+    }
+    // Workers only start once every deque exists, since they steal from all of them.
+    for (int i = 0; i < g_pool.worker_count; i++) {
+        PoolWorker* worker = &g_pool.workers[i];
+        if (pthread_create(&worker->handle, NULL, pool_worker_routine, worker) != 0) {
+            fprintf(stderr, "Failed to start the task pool.\n");
+            exit(1);
+        }
+        pthread_detach(worker->handle);
+    }
+}
+
+AngaraObject angara_spawn_task(AngaraObject closure, int arg_count, AngaraObject args[]) {
+    pthread_once(&g_pool_once, init_pool);
+
+    // 1. The task carries its closure and arguments; like the task itself, they
+    //    are now reachable from two threads.
+    AngaraRegion* region = suspend_regions();
+    AngaraThread* task = (AngaraThread*)angara_object_alloc(
+        sizeof(AngaraThread) + sizeof(AngaraObject) * (size_t)arg_count, OBJ_THREAD);
+    resume_regions(region);
+    task->obj.flags |= ANGARA_OBJ_SHARED;
+    task->is_task = true;
+    task->joined = false;
+    task->done = 0;
+    task->waiting = 0;
+    task->next = NULL;
+    task->return_value = angara_create_nil();
+    task->closure = share_reference(closure);
+    task->arg_count = arg_count;
+    for (int i = 0; i < arg_count; i++) task->args[i] = share_reference(args[i]);
+    AngaraObject task_obj = ANGARA_OBJ_VAL(task);
+    angara_incref(task_obj); // The queue's reference, released once the task has run.
+
+    // 2. A worker keeps its own tasks; anyone else goes through the shared queue.
+    if (t_worker != NULL) {
+        deque_push(t_worker, task);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&g_pool.idle, __ATOMIC_SEQ_CST) > 0) {
+            pthread_mutex_lock(&g_pool.lock);
+            pthread_cond_signal(&g_pool.work_ready);
+            pthread_mutex_unlock(&g_pool.lock);
+        }
+    } else {
+        pthread_mutex_lock(&g_pool.lock);
+        if (g_pool.queue_tail != NULL) g_pool.queue_tail->next = task;
+        else g_pool.queue_head = task;
+        g_pool.queue_tail = task;
+        __atomic_add_fetch(&g_pool.queued, 1, __ATOMIC_SEQ_CST);
+        if (g_pool.idle > 0) pthread_cond_signal(&g_pool.work_ready);
+        pthread_mutex_unlock(&g_pool.lock);
+    }
+    return task_obj;
+}
+
+// Runs pending tasks until `task` is done, and sleeps only when there are none.
+static void wait_for_task(AngaraThread* task) {
+    int spins = 0;
+    while (!__atomic_load_n(&task->done, __ATOMIC_ACQUIRE)) {
+        AngaraThread* other;
+        if (t_help_depth < POOL_MAX_HELP_DEPTH) other = pool_find_task();
+        else other = t_worker != NULL ? deque_pop(t_worker) : NULL;
+        if (other != NULL) {
+            t_help_depth++;
+            run_task(other);
+            t_help_depth--;
+            spins = 0;
+            continue;
+        }
+        if (spins++ < POOL_SPINS_BEFORE_SLEEP) {
+            sched_yield();
+            continue;
+        }
+        // The timeout lets the joiner help again if new tasks were spawned meanwhile.
+        pthread_mutex_lock(&g_pool.lock);
+        __atomic_store_n(&task->waiting, 1, __ATOMIC_SEQ_CST);
+        if (!__atomic_load_n(&task->done, __ATOMIC_SEQ_CST)) {
+            struct timespec deadline;
+            clock_gettime(CLOCK_REALTIME, &deadline);
+            deadline.tv_nsec += 1000000;
+            if (deadline.tv_nsec >= 1000000000) {
+                deadline.tv_sec++;
+                deadline.tv_nsec -= 1000000000;
+            }
+            pthread_cond_timedwait(&g_pool.task_done, &g_pool.lock, &deadline);
+        }
+        pthread_mutex_unlock(&g_pool.lock);
+        spins = 0;
+    }
+}
+
 typedef struct {
     AngaraObject closure;
     int arg_count;
@@ -493,10 +2566,12 @@ typedef struct {
 // It's a simple wrapper that calls our Angara function.
 void* thread_starter_routine(void* arg) {
     const ThreadStartData* start_data = (ThreadStartData*)arg;
-    AngaraThread* thread_obj = (AngaraThread*)start_data->args[0].as.obj;
+    AngaraThread* thread_obj = (AngaraThread*)AS_OBJ(start_data->args[0]);
 
     const AngaraObject result = angara_call(start_data->closure, start_data->arg_count - 1, start_data->args + 1);
-    thread_obj->return_value = result;
+    angara_exit_if_uncaught();
+    // The joining thread reads the result, so it must be shared before it is published.
+    thread_obj->return_value = angara_share(result);
 
     // Cleanup
     angara_decref(start_data->closure);
@@ -513,9 +2588,10 @@ AngaraObject angara_spawn_thread(AngaraObject closure, int arg_count, AngaraObje
     ThreadStartData* start_data = (ThreadStartData*)malloc(sizeof(ThreadStartData));
     if (!start_data) { /* out of memory */ return angara_create_nil(); }
 
-    start_data->closure = closure;
     start_data->arg_count = arg_count + 1; // +1 for the thread object itself
-    angara_incref(closure);
+    // From here on the closure and arguments are reachable from two threads,
+    // so their reference counts must switch to atomic updates before the spawn.
+    start_data->closure = share_reference(closure);
 
 
     // 2. Allocate a NEW array on the HEAP for the arguments.
@@ -523,12 +2599,17 @@ AngaraObject angara_spawn_thread(AngaraObject closure, int arg_count, AngaraObje
     if (!start_data->args) { /* out of memory */ free(start_data); return angara_create_nil(); }
 
     // 3. Create the AngaraThread object that we will return to the user.
-    AngaraThread* thread_obj = (AngaraThread*)malloc(sizeof(AngaraThread));
-    // ... (check malloc) ...
-    thread_obj->obj.type = OBJ_THREAD;
-    thread_obj->obj.ref_count = 1;
+    AngaraRegion* region = suspend_regions();
+    AngaraThread* thread_obj = (AngaraThread*)angara_object_alloc(sizeof(AngaraThread), OBJ_THREAD);
+    resume_regions(region);
+    thread_obj->obj.flags |= ANGARA_OBJ_SHARED; // Held by both the spawner and the new thread.
+    thread_obj->is_task = false;
+    thread_obj->joined = false;
+    thread_obj->next = NULL;
     thread_obj->return_value = angara_create_nil();
-    AngaraObject thread_angara_obj = { VAL_OBJ, { .obj = (Object*)thread_obj }};
+    thread_obj->closure = angara_create_nil();
+    thread_obj->arg_count = 0;
+    AngaraObject thread_angara_obj = ANGARA_OBJ_VAL(thread_obj);
 
     // 4. Copy the arguments from the temporary stack array into our new heap array.
 
@@ -538,8 +2619,7 @@ AngaraObject angara_spawn_thread(AngaraObject closure, int arg_count, AngaraObje
 
     // Copy the rest of the arguments from the caller.
     for (int i = 0; i < arg_count; ++i) {
-        start_data->args[i + 1] = args[i];
-        angara_incref(args[i]); // The start_data now holds a reference
+        start_data->args[i + 1] = share_reference(args[i]); // The start_data now holds a reference
     }
 
 
@@ -550,7 +2630,7 @@ AngaraObject angara_spawn_thread(AngaraObject closure, int arg_count, AngaraObje
         for(int i = 0; i < start_data->arg_count; ++i) angara_decref(start_data->args[i]);
         free(start_data->args);
         free(start_data);
-        free(thread_obj); // Not an Angara object yet, just free it
+        angara_object_free((Object*)thread_obj); // Never handed out, so release it directly
         angara_throw_error("Failed to create new thread.");
         return angara_create_nil();
     }
@@ -565,8 +2645,13 @@ AngaraObject angara_thread_join(AngaraObject thread_obj) {
     }
     AngaraThread* thread = AS_THREAD(thread_obj);
 
-    // 1. Wait for the C thread to finish its execution.
-    pthread_join(thread->handle, NULL);
+    // 1. Wait for the task or the C thread to finish its execution.
+    if (thread->is_task) {
+        wait_for_task(thread);
+    } else if (!thread->joined) {
+        pthread_join(thread->handle, NULL);
+        thread->joined = true;
+    }
 
     // 2. Return the value that the thread stored.
     //    The caller now gets a reference to this value.
@@ -575,13 +2660,11 @@ AngaraObject angara_thread_join(AngaraObject thread_obj) {
 }
 
 AngaraObject angara_closure_new(GenericAngaraFn fn, int arity, bool is_native) {
-    AngaraClosure* closure = (AngaraClosure*)malloc(sizeof(AngaraClosure));
-    closure->obj.type = OBJ_CLOSURE;
-    closure->obj.ref_count = 1;
+    AngaraClosure* closure = (AngaraClosure*)angara_object_alloc(sizeof(AngaraClosure), OBJ_CLOSURE);
     closure->fn = fn;
     closure->arity = arity;
     closure->is_native = is_native;
-    return (AngaraObject){VAL_OBJ, {.obj = (Object*)closure}};
+    return ANGARA_OBJ_VAL(closure);
 }
 
 AngaraObject angara_call(AngaraObject closure_obj, int arg_count, AngaraObject args[]) {
@@ -608,18 +2691,19 @@ AngaraObject angara_call(AngaraObject closure_obj, int arg_count, AngaraObject a
 }
 
 AngaraObject angara_mutex_new(void) {
-    AngaraMutex* mutex = (AngaraMutex*)malloc(sizeof(AngaraMutex));
-    mutex->obj.type = OBJ_MUTEX;
-    mutex->obj.ref_count = 1;
+    // A mutex exists to be shared, so it never lives in a region.
+    AngaraRegion* region = suspend_regions();
+    AngaraMutex* mutex = (AngaraMutex*)angara_object_alloc(sizeof(AngaraMutex), OBJ_MUTEX);
+    resume_regions(region);
 
     // Initialize the underlying pthread mutex
     if (pthread_mutex_init(&mutex->handle, NULL) != 0) {
         printf("Error: Failed to initialize mutex.\n");
-        free(mutex);
+        angara_object_free((Object*)mutex);
         return angara_create_nil();
     }
 
-    return (AngaraObject){VAL_OBJ, {.obj = (Object*)mutex}};
+    return ANGARA_OBJ_VAL(mutex);
 }
 
 void angara_mutex_lock(AngaraObject mutex_obj) {
@@ -632,10 +2716,13 @@ void angara_mutex_unlock(AngaraObject mutex_obj) {
     pthread_mutex_unlock(&AS_MUTEX(mutex_obj)->handle);
 }
 
+// Each of these replaces the boxed number in `lvalue`, dropping the old box.
 AngaraObject angara_pre_increment(AngaraObject* lvalue) {
     // Note: Assumes the type is i64 for simplicity. A real implementation
     // would check for floats as well.
-    lvalue->as.i64++;
+    AngaraObject old_value = *lvalue;
+    *lvalue = angara_create_i64(AS_I64(old_value) + 1);
+    angara_decref(old_value);
     // Returns the NEW value.
     angara_incref(*lvalue); // The caller gets a new reference.
     return *lvalue;
@@ -643,45 +2730,51 @@ AngaraObject angara_pre_increment(AngaraObject* lvalue) {
 
 AngaraObject angara_post_increment(AngaraObject* lvalue) {
     // Returns the ORIGINAL value.
-    AngaraObject original_value = angara_create_i64(lvalue->as.i64);
-    lvalue->as.i64++;
-    // No incref needed, create_i64 returns a fresh value.
+    // The old box becomes the caller's reference to the original value.
+    AngaraObject original_value = *lvalue;
+    *lvalue = angara_create_i64(AS_I64(original_value) + 1);
     return original_value;
 }
 
 AngaraObject angara_pre_decrement(AngaraObject* lvalue) {
-    lvalue->as.i64--;
+    AngaraObject old_value = *lvalue;
+    *lvalue = angara_create_i64(AS_I64(old_value) - 1);
+    angara_decref(old_value);
     angara_incref(*lvalue);
     return *lvalue;
 }
 
 AngaraObject angara_post_decrement(AngaraObject* lvalue) {
-    AngaraObject original_value = angara_create_i64(lvalue->as.i64);
-    lvalue->as.i64--;
+    AngaraObject original_value = *lvalue;
+    *lvalue = angara_create_i64(AS_I64(original_value) - 1);
     return original_value;
 }
 
+// Evaluates to a statically allocated, immortal string: no allocation, no counting.
+#define CONSTANT_STRING(text) ({ static AngaraString constant = ANGARA_STATIC_STRING(text); ANGARA_OBJ_VAL(&constant); })
+
 AngaraObject angara_typeof(AngaraObject value) {
-    switch (value.type) {
-        case VAL_NIL:   return angara_string_from_c("nil");
-        case VAL_BOOL:  return angara_string_from_c("bool");
-        case VAL_I64:   return angara_string_from_c("i64");
-        case VAL_F64:   return angara_string_from_c("f64");
+    switch (VALUE_TYPE(value)) {
+        case VAL_NIL:   return CONSTANT_STRING("nil");
+        case VAL_BOOL:  return CONSTANT_STRING("bool");
+        case VAL_I64:   return CONSTANT_STRING("i64");
+        case VAL_F64:   return CONSTANT_STRING("f64");
         case VAL_OBJ:
             switch (OBJ_TYPE(value)) {
-                case OBJ_STRING:   return angara_string_from_c("string");
-                case OBJ_LIST:     return angara_string_from_c("list");
-                case OBJ_RECORD:   return angara_string_from_c("record");
-                case OBJ_CLOSURE:  return angara_string_from_c("function");
-                case OBJ_CLASS:    return angara_string_from_c("class");
-                case OBJ_INSTANCE: return angara_string_from_c("instance");
-                case OBJ_THREAD:   return angara_string_from_c("Thread");
-                case OBJ_MUTEX:    return angara_string_from_c("Mutex");
-                case OBJ_EXCEPTION:return angara_string_from_c("Exception");
-                default:           return angara_string_from_c("unknown object");
+                case OBJ_STRING:   return CONSTANT_STRING("string");
+                case OBJ_LIST:     return CONSTANT_STRING("list");
+                case OBJ_RECORD:   return CONSTANT_STRING("record");
+                case OBJ_CLOSURE:  return CONSTANT_STRING("function");
+                case OBJ_CLASS:    return CONSTANT_STRING("class");
+                case OBJ_INSTANCE: return CONSTANT_STRING("instance");
+                case OBJ_THREAD:   return CONSTANT_STRING("Thread");
+                case OBJ_MUTEX:    return CONSTANT_STRING("Mutex");
+                case OBJ_STRING_BUILDER: return CONSTANT_STRING("StringBuilder");
+                case OBJ_EXCEPTION:return CONSTANT_STRING("Exception");
+                default:           return CONSTANT_STRING("unknown object");
             }
         default:
-            return angara_string_from_c("unknown");
+            return CONSTANT_STRING("unknown");
     }
 }
 
@@ -700,77 +2793,64 @@ void angara_throw_error(const char* message) {
     angara_throw(exception_obj);
 }
 
-// And a more efficient string creator for the ABI.
+// Adopts a malloc'd buffer handed over by a native module (e.g. a line or a
+// whole file that was just read) without copying it. The buffer is freed
+// together with the string.
 AngaraObject angara_create_string_no_copy(char* chars, size_t length) {
-    AngaraString* string = (AngaraString*)malloc(sizeof(AngaraString));
-    string->obj.type = OBJ_STRING;
-    string->obj.ref_count = 1;
+    AngaraString* string = (AngaraString*)angara_object_alloc(sizeof(AngaraString), OBJ_STRING);
     string->length = length;
     string->chars = chars; // Takes ownership of the pointer
-    return (AngaraObject){VAL_OBJ, {.obj = (Object*)string}};
+    string->hash = 0;
+    string->is_slice = false;
+    return ANGARA_OBJ_VAL(string);
 }
 
 AngaraObject angara_create_string(const char* chars) {
-    size_t length = strlen(chars);
-
-    // 1. Allocate a new buffer and copy the string data into it.
-    //    The new AngaraString will own this new buffer.
-    char* heap_chars = (char*)malloc(length + 1);
-    if (!heap_chars) {
-        // In a real-world scenario, you might want a more graceful
-        // out-of-memory error, but for now this is okay.
-        return angara_create_nil();
-    }
-    memcpy(heap_chars, chars, length);
-    heap_chars[length] = '\0';
-
-    // 2. Call the no-copy version to do the final object creation.
-    //    This avoids duplicating the object allocation logic.
-    return angara_create_string_no_copy(heap_chars, length);
+    return angara_create_string_with_len(chars, strlen(chars));
 }
 
-AngaraObject angara_equals(AngaraObject a, AngaraObject b) {
-    if (a.type != b.type) {
-        // Special case: allow comparing any number to any other number
-        if ((IS_I64(a) || IS_F64(a)) && (IS_I64(b) || IS_F64(b))) {
-            return angara_create_bool(AS_F64(a) == AS_F64(b));
-        }
-        return angara_create_bool(false); // Different types are not equal
-    }
+AngaraObject angara_equals(AngaraObject a, AngaraObject b) { return angara_fast_equals(a, b); }
 
-    switch (a.type) {
-        case VAL_NIL: return angara_create_bool(true);
-        case VAL_BOOL: return angara_create_bool(AS_BOOL(a) == AS_BOOL(b));
-        case VAL_I64: return angara_create_bool(AS_I64(a) == AS_I64(b));
-        case VAL_F64: return angara_create_bool(AS_F64(a) == AS_F64(b));
-        case VAL_OBJ:
-            if (OBJ_TYPE(a) == OBJ_STRING) {
-                return angara_create_bool(strcmp(AS_CSTRING(a), AS_CSTRING(b)) == 0);
-            }
-            // For other objects, compare pointers for now.
-            return angara_create_bool(AS_OBJ(a) == AS_OBJ(b));
+// Slow path for two distinct heap objects, called from the inline equality check.
+bool angara_objects_equal(AngaraObject a, AngaraObject b) {
+    if (OBJ_TYPE(a) == OBJ_STRING && OBJ_TYPE(b) == OBJ_STRING) {
+        return angara_string_equals(AS_STRING(a), AS_STRING(b));
     }
-    return angara_create_bool(false);
+    // For other objects, compare pointers for now.
+    return AS_OBJ(a) == AS_OBJ(b);
 }
 
 AngaraObject angara_to_string(AngaraObject value) {
-    switch (value.type) {
+    switch (VALUE_TYPE(value)) {
         case VAL_NIL:
-            return angara_string_from_c("nil");
+            return CONSTANT_STRING("nil");
         case VAL_BOOL:
-            return angara_string_from_c(AS_BOOL(value) ? "true" : "false");
+            return AS_BOOL(value) ? CONSTANT_STRING("true") : CONSTANT_STRING("false");
         case VAL_I64: {
-            // Determine required size and allocate a buffer for the string.
-            // A 64-bit integer can be up to 20 digits long, plus sign and null terminator.
-            char buffer[22];
-            int len = snprintf(buffer, sizeof(buffer), "%lld", AS_I64(value));
-            return angara_create_string_no_copy(strdup(buffer), len);
+            // The digits are written straight into the new string.
+            size_t length = i64_text_length(AS_I64(value));
+            if (length <= 1) {
+                char digit = (char)('0' + AS_I64(value));
+                return angara_create_string_with_len(&digit, 1);
+            }
+            AngaraString* string = allocate_string(length);
+            if (string == NULL) return angara_create_nil();
+            angara_format_i64(AS_I64(value), string->chars);
+            return ANGARA_OBJ_VAL(string);
         }
         case VAL_F64: {
-            // Use snprintf for safe float-to-string conversion.
-            char buffer[32]; // Sufficient for most float representations
-            int len = snprintf(buffer, sizeof(buffer), "%g", AS_F64(value));
-            return angara_create_string_no_copy(strdup(buffer), len);
+            DecimalF64 decimal;
+            decompose_f64(AS_F64(value), &decimal);
+            size_t length = decimal_text_length(&decimal);
+            if (length <= 1) {
+                char text[ANGARA_NUMBER_TEXT_MAX];
+                write_decimal_text(&decimal, text);
+                return angara_create_string_with_len(text, length);
+            }
+            AngaraString* string = allocate_string(length);
+            if (string == NULL) return angara_create_nil();
+            write_decimal_text(&decimal, string->chars);
+            return ANGARA_OBJ_VAL(string);
         }
         case VAL_OBJ: {
             // If it's already a string, just incref it and return a new reference.
@@ -778,6 +2858,10 @@ AngaraObject angara_to_string(AngaraObject value) {
                 angara_incref(value);
                 return value;
             }
+            // A builder converts to a copy of the text collected so far.
+            if (OBJ_TYPE(value) == OBJ_STRING_BUILDER) {
+                return angara_create_string_with_len(AS_STRING_BUILDER(value)->chars, AS_STRING_BUILDER(value)->length);
+            }
             // --- NEW: Special handling for Exception objects ---
             if (OBJ_TYPE(value) == OBJ_EXCEPTION) {
                 AngaraException* exc = AS_EXCEPTION(value);
@@ -803,7 +2887,7 @@ AngaraObject angara_to_string(AngaraObject value) {
 
 // Converts any AngaraObject into a new AngaraObject of type VAL_I64.
 AngaraObject angara_to_i64(AngaraObject value) {
-    switch (value.type) {
+    switch (VALUE_TYPE(value)) {
         case VAL_NIL:
             return angara_create_i64(0);
         case VAL_BOOL:
@@ -817,8 +2901,7 @@ AngaraObject angara_to_i64(AngaraObject value) {
             return angara_create_i64((int64_t)AS_F64(value));
         case VAL_OBJ: {
             if (OBJ_TYPE(value) == OBJ_STRING) {
-                // Use standard C function to parse string to long long.
-                return angara_create_i64(strtoll(AS_CSTRING(value), NULL, 10));
+                return angara_create_i64(angara_parse_i64(AS_CSTRING(value)));
             }
             // Other object types convert to 0 for now.
             return angara_create_i64(0);
@@ -830,7 +2913,7 @@ AngaraObject angara_to_i64(AngaraObject value) {
 
 // Converts any AngaraObject into a new AngaraObject of type VAL_F64.
 AngaraObject angara_to_f64(AngaraObject value) {
-    switch (value.type) {
+    switch (VALUE_TYPE(value)) {
         case VAL_NIL:
             return angara_create_f64(0.0);
         case VAL_BOOL:
@@ -843,8 +2926,7 @@ AngaraObject angara_to_f64(AngaraObject value) {
             return value;
         case VAL_OBJ: {
             if (OBJ_TYPE(value) == OBJ_STRING) {
-                // Use standard C function to parse string to double.
-                return angara_create_f64(strtod(AS_CSTRING(value), NULL));
+                return angara_create_f64(angara_parse_f64(AS_CSTRING(value)));
             }
             return angara_create_f64(0.0);
         }
@@ -868,32 +2950,218 @@ AngaraObject angara_string_concat(AngaraObject a, AngaraObject b) {
     AngaraString* s2 = AS_STRING(b);
 
     size_t new_len = s1->length + s2->length;
-    char* new_chars = (char*)malloc(new_len + 1);
-    if (!new_chars) {
+    if (new_len <= 1) {
+        // At most one side has a byte; the result is a preallocated small string.
+        return angara_create_string_with_len(s1->length ? s1->chars : s2->chars, new_len);
+    }
+    AngaraString* result = allocate_string(new_len);
+    if (!result) {
         // this should probably throw a proper out-of-memory error.
         return angara_create_nil();
     }
 
     // Copy the first string's content
-    memcpy(new_chars, s1->chars, s1->length);
+    memcpy(result->chars, s1->chars, s1->length);
     // Copy the second string's content right after the first
-    memcpy(new_chars + s1->length, s2->chars, s2->length);
-    new_chars[new_len] = '\0';
+    memcpy(result->chars + s1->length, s2->chars, s2->length);
+
+    return ANGARA_OBJ_VAL(result);
+}
+
+// --- String Building ---
+// A growable string's buffer holds the smallest power of two (at least 16) bytes
+// above its length. The capacity is implied rather than stored; a buffer that is
+// actually larger (e.g. one handed over by a builder) is only underestimated.
+static size_t string_capacity(size_t length) {
+    size_t capacity = 16;
+    while (capacity <= length) capacity *= 2;
+    return capacity;
+}
+
+// The text of one piece of a concatenation. Numbers are formatted into `digits`;
+// any object other than a string is converted, and `converted` dropped afterwards.
+typedef struct {
+    const char* chars;
+    size_t length;
+    AngaraObject converted;
+    char digits[ANGARA_NUMBER_TEXT_MAX];
+} TextPiece;
+
+static void piece_text(AngaraObject value, TextPiece* piece) {
+    piece->converted = angara_create_nil();
+    if (IS_STRING(value)) {
+        piece->chars = AS_STRING(value)->chars;
+        piece->length = AS_STRING(value)->length;
+        return;
+    }
+    int length = format_scalar(value, piece->digits);
+    if (length >= 0) {
+        piece->chars = piece->digits;
+        piece->length = (size_t)length;
+        return;
+    }
+    piece->converted = angara_to_string(value);
+    piece->chars = AS_STRING(piece->converted)->chars;
+    piece->length = AS_STRING(piece->converted)->length;
+}
+
+AngaraObject angara_string_concat_n(size_t count, const AngaraObject* pieces) {
+    // 1. Find the text of every piece, and so the total length. The pieces of a
+    //    typical chain or interpolation fit on the stack.
+    TextPiece stack_texts[16];
+    TextPiece* texts = count <= 16 ? stack_texts : (TextPiece*)malloc(count * sizeof(TextPiece));
+    if (texts == NULL) exit(1);
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++) {
+        piece_text(pieces[i], &texts[i]);
+        total += texts[i].length;
+    }
 
-    // The new string object takes ownership of the buffer.
-    return angara_create_string_no_copy(new_chars, new_len);
+    // 2. Write every piece into a single string of exactly that length.
+    AngaraObject result;
+    char small[2];
+    AngaraString* string = total <= 1 ? NULL : allocate_string(total);
+    char* out = string != NULL ? string->chars : small;
+    for (size_t i = 0; i < count; i++) {
+        memcpy(out, texts[i].chars, texts[i].length);
+        out += texts[i].length;
+    }
+    // At most one byte long: one of the preallocated small strings.
+    result = string != NULL ? ANGARA_OBJ_VAL(string) : angara_create_string_with_len(small, total);
+
+    // 3. Drop the strings made for object pieces.
+    for (size_t i = 0; i < count; i++) angara_decref(texts[i].converted);
+    if (texts != stack_texts) free(texts);
+    return result;
+}
+
+AngaraObject angara_string_append(AngaraObject a, AngaraObject b) {
+    AngaraString* string = AS_STRING(a);
+    AngaraString* tail = AS_STRING(b);
+    size_t old_length = string->length;
+    size_t tail_length = tail->length;
+    size_t length = old_length + tail_length;
+    if (tail_length == 0) return a;
+
+    // 1. Strings are values: one that anything else can see is never changed. The
+    //    result is a growable copy instead, so the next append can be in place.
+    bool unique = string->obj.ref_count == 1 &&
+                  !(string->obj.flags & (ANGARA_OBJ_SHARED | ANGARA_OBJ_UNCOUNTED | ANGARA_OBJ_INTERNED));
+    if (!unique) {
+        char* chars = (char*)malloc(string_capacity(length));
+        if (chars == NULL) exit(1);
+        memcpy(chars, string->chars, old_length);
+        memcpy(chars + old_length, tail->chars, tail_length);
+        chars[length] = '\0';
+        AngaraObject result = angara_create_string_no_copy(chars, length);
+        AS_OBJ(result)->flags |= ANGARA_OBJ_GROWABLE;
+        angara_decref(a);
+        return result;
+    }
+
+    // 2. Make room. Capacity doubles, so a loop of appends copies each byte O(1) times.
+    if (!(string->obj.flags & ANGARA_OBJ_GROWABLE)) {
+        char* chars = (char*)malloc(string_capacity(length));
+        if (chars == NULL) exit(1);
+        memcpy(chars, string->chars, old_length);
+        release_string_chars(string);
+        string->chars = chars;
+        string->is_slice = false;
+        string->obj.flags |= ANGARA_OBJ_GROWABLE;
+    } else if (length >= string_capacity(old_length)) {
+        char* chars = (char*)realloc(string->chars, string_capacity(length));
+        if (chars == NULL) exit(1);
+        string->chars = chars;
+    }
+
+    // 3. `s += s` appends the string to itself; its old bytes are the tail.
+    const char* source = tail == string ? string->chars : tail->chars;
+    memcpy(string->chars + old_length, source, tail_length);
+    string->length = length;
+    string->chars[length] = '\0';
+    string->hash = 0;
+    return a;
+}
+
+// --- String Builder ---
+AngaraObject angara_string_builder_new(void) {
+    // Like a mutex, a builder never lives in a region; its buffer is its own.
+    AngaraRegion* region = suspend_regions();
+    AngaraStringBuilder* builder = (AngaraStringBuilder*)angara_object_alloc(sizeof(AngaraStringBuilder), OBJ_STRING_BUILDER);
+    resume_regions(region);
+    builder->length = 0;
+    builder->capacity = 0;
+    builder->chars = NULL;
+    return ANGARA_OBJ_VAL(builder);
+}
+
+// Makes room for `extra` more bytes. The buffer always keeps a byte spare for
+// the terminator `build()` writes.
+static void reserve_builder(AngaraStringBuilder* builder, size_t extra) {
+    size_t length = builder->length + extra;
+    if (length < builder->capacity) return;
+    size_t capacity = builder->capacity < 64 ? 64 : builder->capacity;
+    while (capacity <= length) capacity *= 2;
+    char* chars = (char*)realloc(builder->chars, capacity);
+    if (chars == NULL) exit(1);
+    builder->chars = chars;
+    builder->capacity = capacity;
+}
+
+void angara_string_builder_append(AngaraObject builder_obj, AngaraObject value) {
+    AngaraStringBuilder* builder = AS_STRING_BUILDER(builder_obj);
+
+    // Numbers, booleans and nil are formatted straight into the buffer.
+    if (!IS_OBJ(value)) {
+        reserve_builder(builder, ANGARA_NUMBER_TEXT_MAX);
+        builder->length += (size_t)format_scalar(value, builder->chars + builder->length);
+        return;
+    }
+
+    TextPiece text;
+    piece_text(value, &text);
+    reserve_builder(builder, text.length);
+    memcpy(builder->chars + builder->length, text.chars, text.length);
+    builder->length += text.length;
+    angara_decref(text.converted);
+}
+
+void angara_string_builder_clear(AngaraObject builder_obj) {
+    // The buffer is kept for the next round of appends.
+    AS_STRING_BUILDER(builder_obj)->length = 0;
+}
+
+AngaraObject angara_string_builder_build(AngaraObject builder_obj) {
+    AngaraStringBuilder* builder = AS_STRING_BUILDER(builder_obj);
+    if (builder->length <= 1) {
+        AngaraObject result = angara_create_string_with_len(builder->chars, builder->length);
+        builder->length = 0;
+        return result;
+    }
+
+    // The buffer becomes the string's own, spare room included, so the result can
+    // keep growing in place; the builder starts over with a fresh one.
+    builder->chars[builder->length] = '\0';
+    AngaraObject result = angara_create_string_no_copy(builder->chars, builder->length);
+    AS_OBJ(result)->flags |= ANGARA_OBJ_GROWABLE;
+    builder->chars = NULL;
+    builder->length = 0;
+    builder->capacity = 0;
+    return result;
 }
 
 AngaraObject angara_record_get_with_angara_key(AngaraObject record_obj, AngaraObject key_obj) {
-    if (!IS_STRING(key_obj)) return angara_create_nil();
-    return angara_record_get(record_obj, AS_CSTRING(key_obj));
+    if (!IS_STRING(key_obj) || !IS_RECORD(record_obj)) return angara_create_nil();
+    RecordKey key = record_key_from_string(AS_STRING(key_obj));
+    return record_get_entry(AS_RECORD(record_obj), &key);
 }
 
 void angara_record_set_with_angara_key(AngaraObject record_obj, AngaraObject key_obj, AngaraObject value_obj) {
     // This is safe because the transpiler will only generate calls to this
     // if the key is a string. We can add a check for safety.
-    if (IS_STRING(key_obj)) {
-        angara_record_set(record_obj, AS_CSTRING(key_obj), value_obj);
+    if (IS_STRING(key_obj) && IS_RECORD(record_obj)) {
+        RecordKey key = record_key_from_string(AS_STRING(key_obj));
+        record_set_entry(AS_RECORD(record_obj), &key, value_obj);
     }
 }
 
@@ -903,13 +3171,11 @@ AngaraObject angara_exception_new(AngaraObject message) {
         message = angara_string_from_c("Non-string value provided to Exception constructor.");
     }
 
-    AngaraException* exc = (AngaraException*)malloc(sizeof(AngaraException));
-    exc->obj.type = OBJ_EXCEPTION;
-    exc->obj.ref_count = 1;
+    AngaraException* exc = (AngaraException*)angara_object_alloc(sizeof(AngaraException), OBJ_EXCEPTION);
     exc->message = message;
     angara_incref(message); // The exception now holds a reference to the message
 
-    return (AngaraObject){VAL_OBJ, {.obj = (Object*)exc}};
+    return ANGARA_OBJ_VAL(exc);
 }
 
 AngaraObject angara_list_remove_at(AngaraObject list_obj, AngaraObject index_obj) {
@@ -927,18 +3193,21 @@ AngaraObject angara_list_remove_at(AngaraObject list_obj, AngaraObject index_obj
 
     // 1. Get the value to be returned. We don't incref, as we are
     //    transferring the list's ownership to the caller.
-    AngaraObject removed_value = list->elements[index];
+    AngaraObject removed_value = angara_fast_list_element(list, (size_t)index);
 
     // 2. Shift all subsequent elements one position to the left.
     //    memmove is the safe choice for overlapping memory regions.
     if (list->count > 1 && (size_t)index < list->count - 1) {
-        memmove(&list->elements[index],
-                &list->elements[index + 1],
-                (list->count - index - 1) * sizeof(AngaraObject));
+        size_t element_size = list_element_size(list->kind);
+        char* storage = (char*)list->elements;
+        memmove(storage + index * element_size,
+                storage + (index + 1) * element_size,
+                (list->count - index - 1) * element_size);
     }
 
     // 3. Decrease the list's count.
     list->count--;
+    list->mod_stamp++;
 
     return removed_value;
 }
@@ -954,11 +3223,28 @@ AngaraObject angara_list_remove(AngaraObject list_obj, AngaraObject value_to_rem
 
     // 1. Find the index of the value.
     int64_t found_index = -1;
-    for (size_t i = 0; i < list->count; ++i) {
-        // We reuse the runtime's equality function.
-        if (AS_BOOL(angara_equals(list->elements[i], value_to_remove))) {
-            found_index = (int64_t)i;
-            break;
+    if (IS_STRING(value_to_remove) && list->kind == ANGARA_LIST_BOXED) {
+        // Looking for a string: hash it once, so elements with a cached hash (record
+        // keys, earlier lookups) are ruled out without touching their bytes.
+        AngaraString* needle = AS_STRING(value_to_remove);
+        angara_string_hash(needle);
+        for (size_t i = 0; i < list->count; ++i) {
+            AngaraObject element = list->elements[i];
+            if (IS_STRING(element) && angara_string_equals(AS_STRING(element), needle)) {
+                found_index = (int64_t)i;
+                break;
+            }
+        }
+    } else {
+        for (size_t i = 0; i < list->count; ++i) {
+            // We reuse the runtime's equality function.
+            AngaraObject element = angara_fast_list_element(list, i);
+            bool equal = angara_fast_values_equal(element, value_to_remove);
+            if (list->kind != ANGARA_LIST_BOXED) angara_decref(element);
+            if (equal) {
+                found_index = (int64_t)i;
+                break;
+            }
         }
     }
 
@@ -979,23 +3265,17 @@ AngaraObject angara_record_remove(AngaraObject record_obj, AngaraObject key_obj)
         return angara_create_bool(false);
     }
     AngaraRecord* record = AS_RECORD(record_obj);
-    const char* key_to_remove = AS_CSTRING(key_obj);
+    RecordKey key_to_remove = record_key_from_string(AS_STRING(key_obj));
 
     // 1. Find the index of the key.
-    int64_t found_index = -1;
-    for (size_t i = 0; i < record->count; ++i) {
-        if (strcmp(record->entries[i].key, key_to_remove) == 0) {
-            found_index = (int64_t)i;
-            break;
-        }
-    }
+    int64_t found_index = find_record_entry(record, &key_to_remove);
 
     if (found_index == -1) {
         return angara_create_bool(false); // Key not found.
     }
 
-    // 2. Free the key and decref the value of the entry to be removed.
-    free(record->entries[found_index].key);
+    // 2. Release the key and value of the entry to be removed.
+    angara_decref(ANGARA_OBJ_VAL(record->entries[found_index].key_string));
     angara_decref(record->entries[found_index].value);
 
     // 3. Shift all subsequent elements one position to the left.
@@ -1008,6 +3288,9 @@ AngaraObject angara_record_remove(AngaraObject record_obj, AngaraObject key_obj)
     // 4. Decrease the record's count.
     record->count--;
 
+    // 5. The shift moved every later entry, so the index must be rebuilt.
+    if (record->index != NULL) rebuild_record_index(record);
+
     return angara_create_bool(true); // Success.
 }
 
@@ -1022,8 +3305,8 @@ AngaraObject angara_record_keys(AngaraObject record_obj) {
     AngaraObject keys_list = angara_list_new();
 
     for (size_t i = 0; i < record->count; ++i) {
-        // Create a new Angara string for each key and push it to the list.
-        angara_list_push(keys_list, angara_create_string(record->entries[i].key));
+        // Key strings never change, so the list can share them with the record.
+        angara_list_push(keys_list, ANGARA_OBJ_VAL(record->entries[i].key_string));
     }
 
     return keys_list;
@@ -1033,7 +3316,7 @@ AngaraObject angara_is_instance_of(AngaraObject object, const char* type_name) {
     bool result = false;
 
     // First, check against primitive type names.
-    switch (object.type) {
+    switch (VALUE_TYPE(object)) {
         case VAL_NIL:
             result = (strcmp(type_name, "nil") == 0);
             break;
@@ -1093,18 +3376,12 @@ AngaraObject angara_is_list_of_type(AngaraObject list_obj, const char* element_t
 
     // To be correct, we should check the type of every element.
     // However, since Angara lists are homogeneous, we only need to check the first one.
-    AngaraObject first_element = list->elements[0];
+    AngaraObject first_element = angara_fast_list_element(list, 0);
 
     // We can call our existing `angara_is_instance_of` on the element.
-    return angara_is_instance_of(first_element, element_type_name);
-}
-
-AngaraObject angara_create_string_with_len(const char* chars, size_t length) {
-    char* heap_chars = (char*)malloc(length + 1);
-    if (!heap_chars) { return angara_create_nil(); }
-    memcpy(heap_chars, chars, length);
-    heap_chars[length] = '\0';
-    return angara_create_string_no_copy(heap_chars, length);
+    AngaraObject result = angara_is_instance_of(first_element, element_type_name);
+    if (list->kind != ANGARA_LIST_BOXED) angara_decref(first_element);
+    return result;
 }
 
 AngaraObject angara_from_c_i32(int32_t value) { return angara_create_i64((int64_t)value); }
@@ -1117,30 +3394,25 @@ AngaraObject angara_from_c_c_ptr(void* value) { return angara_create_i64((int64_
 AngaraObject angara_from_c_u64(uint64_t value) { return angara_create_i64((int64_t)value); }
 
 AngaraObject angara_retype_c_ptr(AngaraObject c_ptr_obj, size_t wrapper_size) {
-    if (c_ptr_obj.type != VAL_I64 && c_ptr_obj.type != VAL_NIL) {
+    if (!IS_I64(c_ptr_obj) && !IS_NIL(c_ptr_obj)) {
         // A safety check, though the type checker should prevent this.
         // A c_ptr is stored in the i64 slot.
         return angara_create_nil();
     }
 
     // 1. Allocate memory for our Angara wrapper struct (e.g., Angara_utsname).
-    Object* wrapper_obj = (Object*)malloc(wrapper_size);
-    if (!wrapper_obj) {
-        angara_throw_error("Out of memory during retype operation.");
-        return angara_create_nil();
-    }
-
-    // 2. Initialize the generic Angara object header.
-    wrapper_obj->type = OBJ_DATA_INSTANCE; // We can reuse this type tag.
-    wrapper_obj->ref_count = 1;
+    //    This also initializes the generic Angara object header.
+    Object* wrapper_obj = angara_object_alloc(wrapper_size, OBJ_DATA_INSTANCE); // We can reuse this type tag.
 
-    // 3. This is the crucial step: Store the raw C pointer from the source
+    // 2. This is the crucial step: Store the raw C pointer from the source
     //    object into the `ptr` field of the new wrapper. We assume the `ptr`
-    //    field is the first field after the `Object obj` header.
+    //    field is the first field after the AngaraDataInstance header.
     //    This is a bit of a hack but avoids needing a unique function for every type.
-    void** ptr_field = (void**)((char*)wrapper_obj + sizeof(Object));
+    //    The wrapper does not own the C struct, so there is nothing to drop.
+    ((AngaraDataInstance*)wrapper_obj)->ops = NULL;
+    void** ptr_field = (void**)((char*)wrapper_obj + sizeof(AngaraDataInstance));
     *ptr_field = (void*)AS_I64(c_ptr_obj);
 
-    // 4. Box the new wrapper struct into an AngaraObject and return it.
-    return (AngaraObject){VAL_OBJ, {.obj = wrapper_obj}};
+    // 3. Box the new wrapper struct into an AngaraObject and return it.
+    return ANGARA_OBJ_VAL(wrapper_obj);
 }
\ No newline at end of file
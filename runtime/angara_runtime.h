@@ -21,6 +21,13 @@ typedef enum {
     VAL_NIL, VAL_BOOL, VAL_I64, VAL_F64, VAL_OBJ
 } AngaraValueType;
 
+#ifdef ANGARA_NAN_BOXING
+// A NaN-boxed value: one 64-bit word (the encoding is described in Part 4).
+// It stays a struct so the C compiler keeps it distinct from plain integers.
+typedef struct AngaraObject {
+    uint64_t bits;
+} AngaraObject;
+#else
 typedef struct AngaraObject {
     AngaraValueType type;
     union {
@@ -30,48 +37,123 @@ typedef struct AngaraObject {
         struct Object* obj;
     } as;
 } AngaraObject;
+#endif
 
 
 // --- Heap-Allocated Objects ---
 typedef enum {
     OBJ_STRING, OBJ_LIST, OBJ_RECORD, OBJ_EXCEPTION, OBJ_THREAD, OBJ_MUTEX,
-    OBJ_CLOSURE, OBJ_CLASS, OBJ_INSTANCE, OBJ_NATIVE_INSTANCE, OBJ_DATA_INSTANCE, OBJ_ENUM_INSTANCE
+    OBJ_CLOSURE, OBJ_CLASS, OBJ_INSTANCE, OBJ_NATIVE_INSTANCE, OBJ_DATA_INSTANCE, OBJ_ENUM_INSTANCE,
+    OBJ_STRING_BUILDER,
+    OBJ_WIDE_I64  // A NaN-boxed i64 too wide for the payload (see ANGARA_NAN_BOXING).
 } ObjectType;
 
+// Object header flags (the `flags` byte).
+// An object reachable from more than one thread is marked SHARED; from then on
+// its reference count is only touched with atomic operations. Objects owned by
+// a single thread (the overwhelming majority) keep the cheap non-atomic path.
+#define ANGARA_OBJ_SHARED (1u << 0)
+// An IMMORTAL object (a string literal, an interned key) is never counted or
+// freed; incref/decref leave it untouched. An INTERNED string's `chars` is the
+// canonical copy from the runtime intern table, so equal keys share one pointer.
+#define ANGARA_OBJ_IMMORTAL (1u << 1)
+#define ANGARA_OBJ_INTERNED (1u << 2)
+// A REGION object belongs to the region recorded in `region_depth`. It is not
+// counted; it is released all at once when its region ends.
+#define ANGARA_OBJ_REGION (1u << 3)
+// A MARKED object sits in its thread's cycle-collector candidate buffer. If its
+// count drops to zero there, the collector releases its memory, not the free path.
+#define ANGARA_OBJ_MARKED (1u << 4)
+// Bits 5-6 hold the cycle collector's color for the object while it runs.
+#define ANGARA_OBJ_COLOR_SHIFT 5
+#define ANGARA_OBJ_COLOR_MASK (3u << ANGARA_OBJ_COLOR_SHIFT)
+// A GROWABLE string's `chars` is a heap buffer with spare room at the end, so
+// `s += x` can append in place while `s` holds the only reference. Its capacity
+// is implied by its length (see string_capacity in the runtime).
+#define ANGARA_OBJ_GROWABLE (1u << 7)
+
+// The header at the start of every heap object: 8 bytes, so a small string or
+// enum instance carries half the overhead of a size_t-counted header. The count
+// is 32 bits; no object is expected to be referenced four billion times.
 typedef struct Object {
-    ObjectType type;
-    size_t ref_count;
+    uint8_t type;          // An ObjectType.
+    uint8_t flags;         // ANGARA_OBJ_* bits.
+    uint8_t size_class;    // The allocator size class it came from (0 = malloc).
+    uint8_t region_depth;  // Nesting depth of the owning region (0 = the heap).
+    uint32_t ref_count;
 } Object;
 
+// Initializer for the header of a statically allocated object, which starts
+// out holding the one reference its definition owns.
+#define ANGARA_STATIC_HEADER(object_type, object_flags) \
+    {.type = (object_type), .flags = (object_flags), .ref_count = 1}
+
 
 // --- Concrete Object Struct Definitions ---
 // These are the specific layouts for all object types. While module authors
 // primarily interact with them via `AngaraObject` and helper macros, these
 // definitions are required for the macros to work correctly.
 
+// A string's bytes normally live in `inline_chars`, in the same allocation as
+// the header. `chars` points elsewhere only for buffers adopted through
+// angara_create_string_no_copy, for static literals, and for slices: a slice
+// (see angara_string_slice) points into the bytes of a parent string it keeps
+// alive. A slice is not NUL-terminated; C code that needs a terminator reads it
+// through AS_CSTRING, which copies the bytes out on first use.
 typedef struct {
     Object obj;
     size_t length;
     char* chars;
+    uint32_t hash;  // Hash of the text, computed on first use; 0 until then.
+    bool is_slice;
+    char inline_chars[];
 } AngaraString;
 
+// How a list stores its elements. A list whose static element type is i64, f64
+// or bool keeps the raw values packed, and boxes an element only when it is read
+// through the generic accessors. Storing a value of another type into a packed
+// list converts it to boxed storage first.
+typedef enum {
+    ANGARA_LIST_BOXED,
+    ANGARA_LIST_I64,
+    ANGARA_LIST_F64,
+    ANGARA_LIST_BOOL,
+} AngaraListKind;
+
 typedef struct AngaraList {
     Object obj;
     size_t count;
     size_t capacity;
-    AngaraObject* elements;
+    union {
+        AngaraObject* elements; // ANGARA_LIST_BOXED
+        int64_t* i64s;          // ANGARA_LIST_I64
+        double* f64s;           // ANGARA_LIST_F64
+        uint8_t* bools;         // ANGARA_LIST_BOOL
+    };
+    // Bumped whenever elements are added or removed, so a for-in loop walking
+    // the storage can tell that the list changed under it.
+    uint64_t mod_stamp;
+    AngaraListKind kind;
 } AngaraList;
 
 typedef struct {
-    char* key;
+    char* key;                // The chars of `key_string`; equal literal keys share one pointer.
     AngaraObject value;
+    uint32_t hash;            // Cached hash of `key`.
+    AngaraString* key_string; // Interned for a literal key, else a counted copy the entry owns.
 } RecordEntry;
 
+// `entries` is a dense array in insertion order, so iterating
+// `entries[0..count)` visits fields in the order they were added.
+// Once a record grows past a few fields, `index` holds an open-addressing
+// hash table of entry positions (stored +1, with 0 marking an empty slot).
 typedef struct AngaraRecord {
     Object obj;
     size_t count;
     size_t capacity;
     RecordEntry* entries;
+    uint32_t* index;
+    size_t index_capacity; // Always zero or a power of two.
 } AngaraRecord;
 
 typedef struct {
@@ -79,9 +161,25 @@ typedef struct {
     AngaraObject message;
 } AngaraException;
 
+// Releases the references held in the fields of a compiler-generated object,
+// just before the runtime frees its memory.
+typedef void (*AngaraDropFn)(Object* object);
+// Calls `visit` on every boxed field slot of a compiler-generated object. The
+// cycle collector uses it to find (and finally clear) an object's children.
+typedef void (*AngaraVisitFn)(AngaraObject* slot, void* context);
+typedef void (*AngaraTraverseFn)(Object* object, AngaraVisitFn visit, void* context);
+
+// The per-type functions of a data or enum type.
+typedef struct AngaraTypeOps {
+    AngaraDropFn drop;
+    AngaraTraverseFn traverse;
+} AngaraTypeOps;
+
 typedef struct AngaraClass {
     Object obj;
     char* name;
+    AngaraDropFn drop;           // Releases an instance's fields, including inherited ones.
+    AngaraTraverseFn traverse;   // Visits the same fields.
 } AngaraClass;
 
 typedef struct AngaraInstance {
@@ -89,6 +187,13 @@ typedef struct AngaraInstance {
     AngaraClass* klass;
 } AngaraInstance;
 
+// The header of data and enum instances. They have no class, so the functions
+// that walk their fields are reached from the object itself (NULL for none).
+typedef struct AngaraDataInstance {
+    Object obj;
+    const AngaraTypeOps* ops;
+} AngaraDataInstance;
+
 typedef AngaraObject (*GenericAngaraFn)(int arg_count, AngaraObject args[]);
 typedef struct AngaraClosure {
     Object obj;
@@ -97,10 +202,21 @@ typedef struct AngaraClosure {
     bool is_native;
 } AngaraClosure;
 
+// What `spawn` returns: a task queued on the runtime's worker pool, whose
+// `join` runs other pending tasks while it waits. `spawn_thread` creates the
+// same object around a dedicated OS thread instead (`is_task` is false).
 typedef struct AngaraThread {
     Object obj;
-    pthread_t handle;
+    bool is_task;
+    bool joined;                 // OS threads only: `handle` was joined.
+    int done;                    // Tasks only: set once `return_value` is published.
+    int waiting;                 // Tasks only: a joiner is asleep on the pool.
+    pthread_t handle;            // OS threads only.
+    struct AngaraThread* next;   // The pool's queue for tasks spawned outside it.
     AngaraObject return_value;
+    AngaraObject closure;        // Tasks only, released once the task has run.
+    int arg_count;
+    AngaraObject args[];
 } AngaraThread;
 
 typedef struct AngaraMutex {
@@ -108,6 +224,15 @@ typedef struct AngaraMutex {
     pthread_mutex_t handle;
 } AngaraMutex;
 
+// Collects text in a buffer that grows geometrically. `build()` hands the buffer
+// to a new string without copying it and leaves the builder empty.
+typedef struct {
+    Object obj;
+    size_t length;
+    size_t capacity;
+    char* chars;
+} AngaraStringBuilder;
+
 typedef void (*AngaraFinalizerFn)(void* data);
 typedef struct {
     Object obj;
@@ -135,18 +260,52 @@ AngaraObject angara_create_string_no_copy(char* owned_chars, size_t length);
 AngaraObject angara_create_native_instance(void* data, AngaraFinalizerFn finalizer);
 AngaraObject angara_exception_new(AngaraObject message);
 AngaraObject angara_list_new(void);
+// An empty list with room for `capacity` elements, for results whose size is known up front.
+AngaraObject angara_list_new_with_capacity(size_t capacity);
 AngaraObject angara_record_new(void);
 AngaraObject angara_mutex_new(void);
+AngaraObject angara_string_builder_new(void);
 AngaraObject angara_closure_new(GenericAngaraFn fn, int arity, bool is_native);
 AngaraObject angara_string_from_c(const char* chars);
 AngaraObject angara_to_string(AngaraObject value);
 AngaraObject angara_string_concat(AngaraObject a, AngaraObject b);
+// Concatenates the text of `count` values into one string, sized up front. Strings
+// are copied as they are; any other value as angara_to_string would render it.
+AngaraObject angara_string_concat_n(size_t count, const AngaraObject* pieces);
+// Appends string `b` to string `a`, taking over the caller's reference to `a`.
+// When that is the only reference, `a` grows in place and is returned itself.
+AngaraObject angara_string_append(AngaraObject a, AngaraObject b);
+// A string of `length` bytes from `start` in `string`, sharing its bytes instead
+// of copying them. Callers check the bounds.
+AngaraObject angara_string_slice(AngaraObject string, size_t start, size_t length);
+// Gives a slice its own NUL-terminated copy of its bytes and returns them.
+// Any other string's bytes are returned as they are.
+char* angara_string_materialize(AngaraString* string);
+// The string's hash, computed once and cached in the string. Records and the
+// intern table key on it, and equality uses it to rule out a match early.
+uint32_t angara_string_hash(AngaraString* string);
+// Compares lengths, then cached hashes, then the bytes, 16 at a time.
+bool angara_string_equals(AngaraString* a, AngaraString* b);
 AngaraObject angara_record_get_with_angara_key(AngaraObject record_obj, AngaraObject key_obj);
 void angara_record_set_with_angara_key(AngaraObject record_obj, AngaraObject key_obj, AngaraObject value_obj);
 AngaraObject angara_record_get(AngaraObject record_obj, const char* key);
 void angara_record_set(AngaraObject record_obj, const char* key, AngaraObject value);
 AngaraObject angara_record_new_with_fields(size_t pair_count, AngaraObject kvs[]);
 
+// --- Number Conversion ---
+// Room for the text of any i64 or f64, e.g. "-9223372036854775808" or
+// "-2.2250738585072014e-308". The formatters write no terminator.
+#define ANGARA_NUMBER_TEXT_MAX 32
+// Writes the decimal text of `value` into `out` and returns its length.
+size_t angara_format_i64(int64_t value, char* out);
+// Writes text that parses back to exactly `value`, in %g's layout ("0.1",
+// "1e+20", "nan", "-inf"), and returns its length. The text round-trips; it is
+// usually but not always the shortest such text.
+size_t angara_format_f64(double value, char* out);
+// Parse a leading number like strtoll/strtod, with a fast path for plain decimals.
+int64_t angara_parse_i64(const char* text);
+double angara_parse_f64(const char* text);
+
 // --- Error Handling & Debugging ---
 void angara_throw_error(const char* message);
 void angara_debug_print(const char* message);
@@ -154,12 +313,62 @@ void angara_debug_print(const char* message);
 // --- Memory Management ---
 void angara_incref(AngaraObject value);
 void angara_decref(AngaraObject value);
+// Takes a new reference to `value` and returns it.
+AngaraObject angara_retain(AngaraObject value);
+// True if `value` is a counted object that nobody else references,
+// so its memory may be reused in place.
+bool angara_is_unique(AngaraObject value);
+// Allocates `size` bytes for a heap object and initializes its header
+// (the given type, a reference count of 1, no flags).
+Object* angara_object_alloc(size_t size, ObjectType type);
+// Returns an object's memory to the allocator. Does not touch its contents.
+void angara_object_free(Object* object);
+// Marks a value, and everything reachable from it, as shared between threads.
+// Must be called before handing a value to another thread. Returns `value`,
+// or a heap copy that takes over the caller's reference if `value` lives in a region.
+AngaraObject angara_share(AngaraObject value);
+
+// --- Regions ---
+// Between angara_region_begin() and angara_region_end(), every object this
+// thread allocates is bump-allocated from the region and is not reference
+// counted. Ending the region releases all of them in one go. A region value
+// stored into a container outside the region is copied out to the heap.
+typedef struct AngaraRegion AngaraRegion;
+AngaraRegion* angara_region_begin(void);
+// Ends `region` (and any inner region left open) and returns `result`,
+// copied out of it if necessary, as a reference owned by the caller.
+AngaraObject angara_region_end(AngaraRegion* region, AngaraObject result);
+// Calls `closure` inside a fresh region and returns its result copied out.
+// An exception thrown by the closure is copied out and rethrown.
+AngaraObject angara_region_run(AngaraObject closure, int arg_count, AngaraObject args[]);
+
+// --- Cycle Collector ---
+// Reference counting cannot free objects that reference each other in a cycle.
+// Each thread buffers the lists, records and instances whose count dropped
+// without reaching zero, and from time to time checks by trial deletion whether
+// those candidates are only kept alive by references from each other. The check
+// runs when the buffer fills up, or on demand through angara_gc_collect().
+// Shared objects are never candidates. Build with ANGARA_NO_CYCLE_COLLECTOR to
+// leave cycles to leak instead.
+typedef struct AngaraGCStats {
+    int64_t collections;       // Collections run on this thread.
+    int64_t reclaimed;         // Objects they freed in total.
+    int64_t last_reclaimed;    // Objects freed by the most recent one.
+    double pause_total;        // Seconds spent collecting.
+    double pause_last;
+    double pause_max;
+} AngaraGCStats;
+// Collects this thread's candidate buffer now. Returns the number of objects freed.
+int64_t angara_gc_collect(void);
+AngaraGCStats angara_gc_stats(void);
 
 // --- List Manipulation ---
 void angara_list_push(AngaraObject list, AngaraObject value);
 
 // --- Runtime Internals (for generated code) ---
 // These are used by the transpiler but not typically by module authors directly.
+void angara_intern_literal(AngaraString* literal);
+// Takes over the caller's reference to `exception`.
 void angara_throw(AngaraObject exception);
 AngaraObject angara_call(AngaraObject closure, int arg_count, AngaraObject args[]);
 
@@ -248,6 +457,110 @@ typedef struct {
  safely inspect and manipulate AngaraObjects.
 ===========================================================================
 */
+// These macros are the only supported way to look inside a value: the
+// runtime can be built with either representation (see ANGARA_NAN_BOXING),
+// and code that sticks to them compiles unchanged against both.
+#ifdef ANGARA_NAN_BOXING
+/*
+ NaN-boxed representation. Every value is one 64-bit word:
+
+   0x0000 0000 0000 0000             nil
+   0x0000 0000 0000 0002 / ...0003   false / true
+   0x0000 pppp pppp ppp0             object pointer
+   0x0000 pppp pppp ppp4             pointer to a wide i64 cell (see below)
+   0x0002 ... up to 0xFFF2 ...       double: its IEEE bits plus 2^49
+   0xFFF8 ... up to 0xFFFF ...       i64 in [-2^50, 2^50), in the low 51 bits
+
+ Doubles are offset rather than stored raw so that the all-zero word is nil,
+ which keeps zero-initialized globals, fields and exception slots nil exactly
+ as in the tagged-union build. NaNs are canonicalized when boxed. Object
+ pointers must fit in 48 bits, which holds for user-space addresses on
+ x86-64 and AArch64.
+
+ An i64 outside the 51-bit payload is boxed into a counted heap cell
+ (angara_box_wide_i64), freed when its last reference is dropped like any
+ other object. Cells are immutable, so they are allocated outside regions and
+ marked SHARED from the start: any thread may count them, and nothing has to
+ copy or share them later. Typed i64 variables, fields and packed lists hold
+ raw C integers and are never affected.
+*/
+#define ANGARA_NAN_DOUBLE_OFFSET (UINT64_C(1) << 49)
+#define ANGARA_NAN_INT_TAG       UINT64_C(0xFFF8000000000000)
+#define ANGARA_NAN_INT_MASK      ((UINT64_C(1) << 51) - 1)
+#define ANGARA_NAN_NOT_OBJ       UINT64_C(0xFFFE000000000006)
+#define ANGARA_NAN_FALSE         UINT64_C(2)
+#define ANGARA_NAN_TRUE          UINT64_C(3)
+#define ANGARA_NAN_WIDE_TAG      UINT64_C(4)
+
+typedef struct {
+    Object obj;
+    int64_t value;
+} AngaraWideInt;
+
+// Returns a new reference to a fresh cell holding `value`.
+AngaraObject angara_box_wide_i64(int64_t value);
+
+static inline bool angara_nan_is_wide_i64(AngaraObject value) {
+    return (value.bits & (ANGARA_NAN_NOT_OBJ | 1)) == ANGARA_NAN_WIDE_TAG;
+}
+static inline AngaraWideInt* angara_nan_as_wide(AngaraObject value) {
+    return (AngaraWideInt*)(uintptr_t)(value.bits & ~UINT64_C(7));
+}
+static inline bool angara_nan_is_i64(AngaraObject value) {
+    return value.bits >= ANGARA_NAN_INT_TAG || angara_nan_is_wide_i64(value);
+}
+static inline bool angara_nan_is_f64(AngaraObject value) {
+    return value.bits - ANGARA_NAN_DOUBLE_OFFSET < ANGARA_NAN_INT_TAG - ANGARA_NAN_DOUBLE_OFFSET;
+}
+static inline bool angara_nan_is_obj(AngaraObject value) {
+    return value.bits != 0 && (value.bits & ANGARA_NAN_NOT_OBJ) == 0;
+}
+static inline int64_t angara_nan_as_i64(AngaraObject value) {
+    if (value.bits >= ANGARA_NAN_INT_TAG) return (int64_t)(value.bits << 13) >> 13;
+    return angara_nan_as_wide(value)->value;
+}
+static inline double angara_nan_as_f64(AngaraObject value) {
+    union { uint64_t bits; double f64; } raw = { .bits = value.bits - ANGARA_NAN_DOUBLE_OFFSET };
+    return raw.f64;
+}
+static inline AngaraObject angara_nan_from_i64(int64_t value) {
+    if ((uint64_t)value + (UINT64_C(1) << 50) <= ANGARA_NAN_INT_MASK) {
+        return (AngaraObject){ANGARA_NAN_INT_TAG | ((uint64_t)value & ANGARA_NAN_INT_MASK)};
+    }
+    return angara_box_wide_i64(value);
+}
+static inline AngaraObject angara_nan_from_f64(double value) {
+    union { double f64; uint64_t bits; } raw = { .f64 = value };
+    if (value != value) raw.bits = UINT64_C(0x7FF8000000000000);
+    return (AngaraObject){raw.bits + ANGARA_NAN_DOUBLE_OFFSET};
+}
+static inline AngaraValueType angara_nan_value_type(AngaraObject value) {
+    if (value.bits == 0) return VAL_NIL;
+    if (angara_nan_is_f64(value)) return VAL_F64;
+    if (angara_nan_is_i64(value)) return VAL_I64;
+    if ((value.bits | 1) == ANGARA_NAN_TRUE) return VAL_BOOL;
+    return VAL_OBJ;
+}
+
+#define IS_NIL(value)     ((value).bits == 0)
+#define IS_BOOL(value)    (((value).bits | 1) == ANGARA_NAN_TRUE)
+#define IS_I64(value)     angara_nan_is_i64(value)
+#define IS_F64(value)     angara_nan_is_f64(value)
+#define IS_OBJ(value)     angara_nan_is_obj(value)
+
+#define AS_BOOL(value)    ((value).bits == ANGARA_NAN_TRUE)
+#define AS_I64(value)     angara_nan_as_i64(value)
+#define AS_F64(value)     angara_nan_as_f64(value)
+#define AS_OBJ(value)     ((Object*)(uintptr_t)(value).bits)
+
+#define VALUE_TYPE(value) angara_nan_value_type(value)
+
+#define ANGARA_NIL_VAL         ((AngaraObject){0})
+#define ANGARA_BOOL_VAL(b)     ((AngaraObject){(b) ? ANGARA_NAN_TRUE : ANGARA_NAN_FALSE})
+#define ANGARA_I64_VAL(i)      angara_nan_from_i64(i)
+#define ANGARA_F64_VAL(d)      angara_nan_from_f64(d)
+#define ANGARA_OBJ_VAL(object) ((AngaraObject){(uint64_t)(uintptr_t)(object)})
+#else
 #define IS_NIL(value)     ((value).type == VAL_NIL)
 #define IS_BOOL(value)    ((value).type == VAL_BOOL)
 #define IS_I64(value)     ((value).type == VAL_I64)
@@ -259,11 +572,33 @@ typedef struct {
 #define AS_F64(value)     ((value).as.f64)
 #define AS_OBJ(value)     ((value).as.obj)
 
+#define VALUE_TYPE(value) ((value).type)
+
+#define ANGARA_NIL_VAL         ((AngaraObject){VAL_NIL, {.i64 = 0}})
+#define ANGARA_BOOL_VAL(b)     ((AngaraObject){VAL_BOOL, {.boolean = (b)}})
+#define ANGARA_I64_VAL(i)      ((AngaraObject){VAL_I64, {.i64 = (i)}})
+#define ANGARA_F64_VAL(d)      ((AngaraObject){VAL_F64, {.f64 = (d)}})
+#define ANGARA_OBJ_VAL(object) ((AngaraObject){VAL_OBJ, {.obj = (Object*)(object)}})
+#endif
+
 #define OBJ_TYPE(value)   (AS_OBJ(value)->type)
 
+// Initializer for a statically allocated, immortal string, e.g.
+//   static AngaraString hello = ANGARA_STATIC_STRING("hello");
+#define ANGARA_STATIC_STRING(text) \
+    {ANGARA_STATIC_HEADER(OBJ_STRING, ANGARA_OBJ_IMMORTAL), sizeof(text) - 1, (char*)(text), 0, false}
+
 #define IS_STRING(value)  (IS_OBJ(value) && OBJ_TYPE(value) == OBJ_STRING)
 #define AS_STRING(value)  ((AngaraString*)AS_OBJ(value))
-#define AS_CSTRING(value) (AS_STRING(value)->chars)
+// The bytes of a string as a NUL-terminated C string. Code that can work with
+// a length should use AS_STRING_CHARS and AS_STRING_LENGTH instead, which never copy.
+#define AS_CSTRING(value) angara_string_cstr(AS_STRING(value))
+#define AS_STRING_CHARS(value)  (AS_STRING(value)->chars)
+#define AS_STRING_LENGTH(value) (AS_STRING(value)->length)
+
+static inline char* angara_string_cstr(AngaraString* string) {
+    return string->is_slice ? angara_string_materialize(string) : string->chars;
+}
 
 #define IS_LIST(value)    (IS_OBJ(value) && OBJ_TYPE(value) == OBJ_LIST)
 #define AS_LIST(value)    ((AngaraList*)AS_OBJ(value))
@@ -282,6 +617,7 @@ typedef struct {
 #define AS_CLOSURE(value)  ((AngaraClosure*)AS_OBJ(value))
 #define AS_THREAD(value)   ((AngaraThread*)AS_OBJ(value))
 #define AS_MUTEX(value)    ((AngaraMutex*)AS_OBJ(value))
+#define AS_STRING_BUILDER(value) ((AngaraStringBuilder*)AS_OBJ(value))
 
 
 /*
@@ -291,10 +627,46 @@ typedef struct {
  These definitions are required by the C code generated by the transpiler.
 ===========================================================================
 */
-#define ANGARA_MAX_EXCEPTION_FRAMES 256
-extern AngaraObject g_current_exception;
-typedef struct ExceptionFrame { jmp_buf buffer; struct ExceptionFrame* prev; } ExceptionFrame;
-extern ExceptionFrame* g_exception_chain_head;
+// Each thread has its own chain of active `try` frames and its own in-flight
+// exception, so threads that throw at the same time never see each other's
+// handlers.
+// `locals` is the height of the thread's owned-locals stack when the `try` was entered.
+typedef struct ExceptionFrame { jmp_buf buffer; struct ExceptionFrame* prev; size_t locals; } ExceptionFrame;
+extern __thread AngaraObject g_current_exception;
+extern __thread ExceptionFrame* g_exception_chain_head;
+
+// The addresses of the owned locals of the running functions, innermost last.
+// Generated code pushes a local when it is declared and pops it when its scope
+// ends (angara_push_local/angara_pop_locals in angara_inline.h), so a throw can
+// release the locals of every frame it unwinds before it jumps.
+typedef struct { AngaraObject** slots; size_t count; size_t capacity; } AngaraLocalStack;
+extern __thread AngaraLocalStack g_owned_locals;
+void angara_grow_owned_locals(void);
+
+// Try frames only need the stack back, not the signal mask, which some libcs
+// save and restore with a system call on every plain setjmp/longjmp. On x86,
+// GCC and Clang's builtins go further and save just the frame, stack pointer
+// and resume address, inline. LLVM does not support them on other targets
+// (AArch64 included), so those use _setjmp/_longjmp.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ANGARA_SETJMP(buffer)  __builtin_setjmp((void**)(buffer))
+#define ANGARA_LONGJMP(buffer) __builtin_longjmp((void**)(buffer), 1)
+#elif defined(__unix__) || defined(__APPLE__)
+#define ANGARA_SETJMP(buffer)  _setjmp(buffer)
+#define ANGARA_LONGJMP(buffer) _longjmp(buffer, 1)
+#else
+#define ANGARA_SETJMP(buffer)  setjmp(buffer)
+#define ANGARA_LONGJMP(buffer) longjmp(buffer, 1)
+#endif
+
+// Built with ANGARA_EXCEPTION_RETURNS, exceptions are ordinary return values
+// instead: angara_throw only records the exception and returns, and generated
+// code checks for a pending exception after every call that can throw, then
+// carries it to the enclosing `catch` or out of the function. No `try` sets a
+// jump buffer, so locals can stay in registers. A throw that reaches the top
+// of main or of a thread is reported by angara_exit_if_uncaught. The check
+// itself, angara_exception_pending, is in angara_inline.h.
+void angara_exit_if_uncaught(void);
 
 extern void angara_runtime_init();
 extern void angara_runtime_shutdown();
@@ -305,18 +677,41 @@ AngaraObject angara_len(AngaraObject collection);
 AngaraObject angara_to_f64(AngaraObject value);
 AngaraObject angara_list_get(AngaraObject list_obj, AngaraObject index_obj);
 void angara_list_set(AngaraObject list_obj, AngaraObject index_obj, AngaraObject value);
+// Typed accessors for packed lists; they fall back to boxing for any other storage.
+int64_t angara_list_get_i64(AngaraObject list_obj, int64_t index);
+double angara_list_get_f64(AngaraObject list_obj, int64_t index);
+bool angara_list_get_bool(AngaraObject list_obj, int64_t index);
+void angara_list_set_i64(AngaraObject list_obj, int64_t index, int64_t value);
+void angara_list_set_f64(AngaraObject list_obj, int64_t index, double value);
+void angara_list_set_bool(AngaraObject list_obj, int64_t index, bool value);
+void angara_list_push_i64(AngaraObject list_obj, int64_t value);
+void angara_list_push_f64(AngaraObject list_obj, double value);
+void angara_list_push_bool(AngaraObject list_obj, bool value);
+// Converts a packed list to boxed storage, e.g. before it takes a value of another type.
+void angara_list_unpack(AngaraList* list);
 AngaraObject angara_to_i64(AngaraObject value);
+// `++`/`--` on a boxed variable; each returns a new reference to the updated or original value.
+AngaraObject angara_pre_increment(AngaraObject* lvalue);
+AngaraObject angara_post_increment(AngaraObject* lvalue);
+AngaraObject angara_pre_decrement(AngaraObject* lvalue);
+AngaraObject angara_post_decrement(AngaraObject* lvalue);
 AngaraObject angara_to_string(AngaraObject value);
 AngaraObject angara_typeof(AngaraObject value);
 AngaraObject angara_create_string(const char* chars);
 void angara_mutex_lock(AngaraObject mutex_obj);
 void angara_mutex_unlock(AngaraObject mutex_obj);
+void angara_string_builder_append(AngaraObject builder_obj, AngaraObject value);
+void angara_string_builder_clear(AngaraObject builder_obj);
+AngaraObject angara_string_builder_build(AngaraObject builder_obj);
 AngaraObject angara_thread_join(AngaraObject thread_obj);
 AngaraObject angara_spawn_thread(AngaraObject closure, int arg_count, AngaraObject args[]);
+AngaraObject angara_spawn_task(AngaraObject closure, int arg_count, AngaraObject args[]);
 
 AngaraObject angara_list_remove_at(AngaraObject list, AngaraObject index); // <-- ADD THIS
 AngaraObject angara_list_remove(AngaraObject list, AngaraObject value);    // <-- ADD THIS
 AngaraObject angara_list_new_with_elements(size_t count, AngaraObject elements[]);
+AngaraObject angara_list_new_packed(AngaraListKind kind, size_t count, const void* values);
+AngaraObject angara_range(int64_t start, int64_t end, int64_t step);
 
 AngaraObject angara_record_remove(AngaraObject record, AngaraObject key); // <-- ADD THIS
 AngaraObject angara_record_keys(AngaraObject record);                    // <-- ADD THIS